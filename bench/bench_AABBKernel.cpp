@@ -0,0 +1,91 @@
+// Microbenchmark: SIMD overlap kernel vs the scalar path
+// Usage: AABBKernelBench [candidates] [repeats]
+
+#include "utils/AABBKernel.h"
+
+#include <bitset>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+    // SoA candidate set, padded to whole batches and aligned for the SIMD loads
+    struct CandidateSoA {
+        std::vector<AABBLanes> batches;
+    };
+
+    CandidateSoA MakeCandidates(size_t count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> pos(0.0f, 2000.0f);
+        std::uniform_real_distribution<float> size(4.0f, 64.0f);
+
+        CandidateSoA soa;
+        soa.batches.resize((count + AABB_BATCH - 1) / AABB_BATCH);
+        for (size_t i = 0; i < count; ++i) {
+            soa.batches[i / AABB_BATCH].Push({ pos(rng), pos(rng), size(rng), size(rng) });
+        }
+        return soa;
+    }
+
+    template<typename Kernel>
+    double Run(const char* name, const std::vector<AABB>& boxes, const CandidateSoA& soa,
+               int repeats, uint64_t& hits, Kernel&& kernel) {
+        hits = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) {
+            for (const AABB& box : boxes) {
+                for (const AABBLanes& lanes : soa.batches) {
+                    hits += std::bitset<AABB_BATCH>(kernel(box, lanes)).count();
+                }
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        const double tests = static_cast<double>(boxes.size()) * soa.batches.size() * AABB_BATCH * repeats;
+        std::printf("%-8s %8.3f ns/test   %10llu hits\n", name, ns / tests,
+                    static_cast<unsigned long long>(hits));
+        return ns;
+    }
+}
+
+int main(int argc, char** argv) {
+    const size_t candidates = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    const int repeats = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::mt19937 rng(1234);
+    const CandidateSoA soa = MakeCandidates(candidates, rng);
+    const std::vector<AABB> boxes = [&] {
+        std::vector<AABB> result;
+        std::uniform_real_distribution<float> pos(0.0f, 2000.0f);
+        for (int i = 0; i < 512; ++i) result.push_back({ pos(rng), pos(rng), 32.0f, 32.0f });
+        return result;
+    }();
+
+#if defined(ENGINE_SIMD_AVX2)
+    const char* simdName = "avx2";
+#elif defined(ENGINE_SIMD_SSE2)
+    const char* simdName = "sse2";
+#else
+    const char* simdName = "scalar*";
+#endif
+
+    std::printf("%zu candidates x %zu boxes x %d repeats\n", candidates, boxes.size(), repeats);
+
+    uint64_t scalarHits = 0, simdHits = 0;
+    const double scalarNs = Run("scalar", boxes, soa, repeats, scalarHits, [](const AABB& box, const AABBLanes& l) {
+        return OverlapMaskScalar(box, l.minX, l.minY, l.maxX, l.maxY) & ((1u << l.count) - 1u);
+    });
+    const double simdNs = Run(simdName, boxes, soa, repeats, simdHits, [](const AABB& box, const AABBLanes& l) {
+        return OverlapMask(box, l);
+    });
+
+    std::printf("speedup  %8.2fx\n", scalarNs / simdNs);
+    if (scalarHits != simdHits) {
+        std::fprintf(stderr, "mismatch: scalar %llu vs simd %llu hits\n",
+                     static_cast<unsigned long long>(scalarHits), static_cast<unsigned long long>(simdHits));
+        return 1;
+    }
+    return 0;
+}
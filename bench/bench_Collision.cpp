@@ -0,0 +1,186 @@
+// Collision broadphase stress benchmark (headless, no SDL)
+// Usage: CollisionBench [maxColliders=100000] [frames=10] [threads=0] [scene=all]
+// Pass maxColliders=1000000 for the 1M data point (minutes per scene, see docs/systems/Collisions.md).
+// Scenes: uniform, clustered, mixed, static. Sizes 1k, 10k, 100k, 1M up to maxColliders.
+
+#include "components/ColliderComponent.h"
+#include "components/PhysicsComponent.h"
+#include "components/TransformComponent.h"
+#include "core/ComponentStorage.h"
+#include "core/EntityManager.h"
+#include "core/JobSystem.h"
+#include "systems/CollisionSystem.h"
+#include "systems/EntityCreationSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// Allocation counter - every operator new in the process goes through here
+namespace {
+    std::atomic<size_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+    enum class Scene { Uniform, Clustered, Mixed, MostlyStatic };
+
+    const char* SceneName(Scene scene) {
+        switch (scene) {
+            case Scene::Uniform:      return "uniform";
+            case Scene::Clustered:    return "clustered";
+            case Scene::Mixed:        return "mixed";
+            case Scene::MostlyStatic: return "static";
+        }
+        return "?";
+    }
+
+    // One ECS world holding just what the CollisionSystem reads
+    struct BenchWorld {
+        EntityManager entityManager;
+        ComponentStorage<TransformComponent> transforms;
+        ComponentStorage<ColliderComponent> colliders;
+        ComponentStorage<PhysicsComponent> physics;
+        EntityCreationSystem creationSystem{&entityManager};
+        CollisionSystem collisionSystem{entityManager, transforms, colliders};
+        std::vector<EntityID> moving;
+
+        BenchWorld() {
+            creationSystem.RegisterStorage(&transforms);
+            creationSystem.RegisterStorage(&colliders);
+            creationSystem.RegisterStorage(&physics);
+            collisionSystem.SetPhysics(&physics);
+        }
+    };
+
+    // Same seed -> same scene on every run / machine
+    void Populate(BenchWorld& world, Scene scene, size_t count) {
+        std::mt19937 rng(0xC0111DE);
+        const float side = std::sqrt(static_cast<float>(count)) * 48.0f;  // ~constant density
+        std::uniform_real_distribution<float> uniform(0.0f, side);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::normal_distribution<float> spread(0.0f, side * 0.02f);
+
+        std::vector<VectorFloat> clusters(32);
+        for (auto& c : clusters) c = { uniform(rng), uniform(rng) };
+
+        for (size_t i = 0; i < count; ++i) {
+            VectorFloat pos{ uniform(rng), uniform(rng) };
+            int w = 16 + static_cast<int>(unit(rng) * 16.0f);
+            int h = w;
+            bool sleeping = false;
+
+            switch (scene) {
+                case Scene::Uniform:
+                    break;
+                case Scene::Clustered: {
+                    const VectorFloat& c = clusters[i % clusters.size()];
+                    pos = { c.x + spread(rng), c.y + spread(rng) };
+                    break;
+                }
+                case Scene::Mixed: {
+                    const float r = unit(rng);
+                    if (r < 0.01f)      w = h = 512;
+                    else if (r < 0.10f) w = h = 96;
+                    else                w = h = 8 + static_cast<int>(unit(rng) * 8.0f);
+                    break;
+                }
+                case Scene::MostlyStatic:
+                    sleeping = unit(rng) < 0.9f;
+                    break;
+            }
+
+            const bool wall = unit(rng) < 0.1f;
+            const CollisionLayer layer = wall ? CollisionLayer::Wall : CollisionLayer::Enemy;
+            const CollisionLayer mask = wall ? CollisionLayer::None : (CollisionLayer::Enemy | CollisionLayer::Wall);
+
+            PhysicsComponent phys;
+            phys.isSleeping = sleeping;
+            phys.restPosition = pos;
+
+            EntityID id = world.creationSystem.CreateEntityWith(
+                TransformComponent{ pos, 0.0f, VectorFloat{1.0f, 1.0f} },
+                ColliderComponent{ w, h, layer, mask },
+                phys
+            );
+            if (!sleeping) world.moving.push_back(id);
+        }
+    }
+
+    void RunScene(Scene scene, size_t count, int frames, JobSystem* jobs) {
+        BenchWorld world;
+        Populate(world, scene, count);
+        world.collisionSystem.SetJobSystem(jobs);
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> jitter(-2.0f, 2.0f);
+
+        // Warm-up frame: grid buckets and buffers reach their steady size
+        world.collisionSystem.Update(1.0f / 60.0f);
+
+        double totalNs = 0.0;
+        size_t totalAllocs = 0;
+        CollisionStats stats;
+
+        for (int frame = 0; frame < frames; ++frame) {
+            // Awake bodies drift a little each frame
+            for (EntityID id : world.moving) {
+                auto* t = world.transforms.Get(id);
+                t->position.x += jitter(rng);
+                t->position.y += jitter(rng);
+            }
+
+            const size_t allocsBefore = g_allocations.load(std::memory_order_relaxed);
+            const auto start = std::chrono::steady_clock::now();
+            world.collisionSystem.Update(1.0f / 60.0f);
+            const auto end = std::chrono::steady_clock::now();
+
+            totalNs += std::chrono::duration<double, std::nano>(end - start).count();
+            totalAllocs += g_allocations.load(std::memory_order_relaxed) - allocsBefore;
+            stats = world.collisionSystem.GetStats();
+        }
+
+        const double frameNs = totalNs / frames;
+        std::printf("%-10s %9zu %10.3f %10.1f %12zu %10zu %10zu\n",
+                    SceneName(scene), count, frameNs / 1e6, frameNs / count,
+                    stats.candidatePairs, stats.collisions, totalAllocs / frames);
+    }
+}
+
+int main(int argc, char** argv) {
+    const size_t maxColliders = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    const int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 10;
+    const unsigned threads = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 0;
+    const std::string only = argc > 4 ? argv[4] : "all";
+
+    std::unique_ptr<JobSystem> jobs;
+    if (threads > 0) jobs = std::make_unique<JobSystem>(threads);
+
+    std::printf("backend: uniform grid, %u worker thread(s), %d frame(s)\n", threads, frames);
+    std::printf("%-10s %9s %10s %10s %12s %10s %10s\n",
+                "scene", "colliders", "ms/frame", "ns/entity", "candidates", "pairs", "allocs");
+
+    for (Scene scene : { Scene::Uniform, Scene::Clustered, Scene::Mixed, Scene::MostlyStatic }) {
+        if (only != "all" && only != SceneName(scene)) continue;
+
+        for (size_t count = 1000; count <= maxColliders; count *= 10) {
+            RunScene(scene, count, frames, jobs.get());
+        }
+    }
+    return 0;
+}
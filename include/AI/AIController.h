@@ -14,6 +14,8 @@
 #include "components/HealthComponent.h"
 #include "event/custom_events/DamageEvent.h"
 
+class SpatialQuery;
+
 enum class AIState {
     Idle,
     Patrol,
@@ -42,6 +44,7 @@ public:
     bool HealthLow() const;
     bool CanSeeEnemy() const;
     bool CanHearEnemy() const;
+    bool HasLineOfSight(const VectorFloat& point) const;
 
     void ToggleFriendliness();
     bool IsFriendly() const;
@@ -125,6 +128,9 @@ public:
     void SetAnimationComponent(AnimationComponent* anim);
     AnimationComponent* GetAnimationComponent();
 
+    // Perception queries (line of sight)
+    void SetSpatialQuery(const SpatialQuery* query);
+
     // Attack cooldown
     void SetAttackCooldown(float cd);
     float GetAttackCooldown() const;
@@ -205,4 +211,7 @@ private:
 
     // Animations
     AnimationComponent* m_animation;
+
+    // Perception queries
+    const SpatialQuery* m_spatialQuery = nullptr;
 };
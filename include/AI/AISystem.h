@@ -13,6 +13,9 @@ public:
     void AddController(AIController* controller);
     void RemoveController(ControllerID id);
     AIController* GetController(ControllerID id) const;
+
+    // Shared spatial queries for all controllers (line of sight etc.)
+    void SetSpatialQuery(const SpatialQuery* query);
  
     // ISystem method
     void Update(float deltaTime) override;
@@ -20,4 +23,5 @@ public:
 private:
     size_t NextControllerID_ = 1;
     std::unordered_map<ControllerID, AIController*> m_controllers;
+    const SpatialQuery* m_spatialQuery = nullptr;
 };
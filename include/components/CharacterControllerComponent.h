@@ -0,0 +1,27 @@
+#pragma once
+
+#include "utils/Vector.h"
+
+// Kinematic walker moved by the CharacterControllerSystem (no PhysicsComponent needed)
+struct CharacterControllerComponent {
+    // Input - set by gameplay code or AI every frame
+    float moveX = 0.0f;           // -1 .. 1
+    bool jump = false;            // consumed by the next Update
+
+    // Tuning
+    float moveSpeed = 160.0f;     // px/s
+    float jumpSpeed = 420.0f;     // px/s
+    float gravity = 1200.0f;      // px/s^2
+    float maxFallSpeed = 900.0f;  // px/s
+    float stepHeight = 8.0f;      // px, ledges up to this high are walked onto
+    float maxSlope = 50.0f;       // degrees, steeper ground blocks like a wall
+    float coyoteTime = 0.1f;      // s, jumping is still allowed this long after leaving the ground
+    float snapDistance = 4.0f;    // px, stays on the ground when walking down steps / slopes
+
+    // State - written by the CharacterControllerSystem
+    VectorFloat velocity{0.0f, 0.0f};
+    bool isGrounded = false;
+    bool hitWall = false;
+    bool hitCeiling = false;
+    float coyoteTimer = 0.0f;
+};
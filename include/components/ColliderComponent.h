@@ -6,9 +6,14 @@ struct ColliderComponent {
     int width, height;
     CollisionLayer layer;  // Who
     CollisionLayer mask;   // With who I can collide
+    bool continuous = false;  // Swept test (CCD) for fast bodies, e.g. projectiles
+    bool isTrigger = false;   // Enter / exit events only, no physics (also implied by Trigger / Sensor layers)
 };
 
+inline bool IsTrigger(const ColliderComponent& c) {
+    return c.isTrigger || HasAnyLayer(c.layer, CollisionLayer::Trigger | CollisionLayer::Sensor);
+}
+
 inline bool CanCollide(const ColliderComponent& a, const ColliderComponent& b) {
-        return static_cast<uint8_t>(a.mask) & static_cast<uint8_t>(b.layer) ||
-               static_cast<uint8_t>(b.mask) & static_cast<uint8_t>(a.layer);
+        return HasAnyLayer(a.mask, b.layer) || HasAnyLayer(b.mask, a.layer);
     }
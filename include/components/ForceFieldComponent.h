@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+#include "utils/Vector.h"
+
+enum class ForceFieldType : uint8_t {
+    Uniform,  // constant acceleration `direction` (wind, currents, gravity zones)
+    Radial,   // pushes away from the centre (negative strength pulls in)
+    Vortex,   // accelerates around the centre (positive strength = clockwise on screen)
+    Drag      // pulls the body velocity towards `direction` (water, air currents)
+};
+
+// Box volume starting at the transform position, like a collider
+struct ForceFieldComponent {
+    ForceFieldType type = ForceFieldType::Uniform;
+    float width = 0.0f;
+    float height = 0.0f;
+
+    VectorFloat direction{0.0f, 0.0f};  // Uniform: acceleration in px/s^2, Drag: flow velocity in px/s
+    float strength = 0.0f;              // Radial / Vortex: px/s^2 at the centre, Drag: 1/s
+    bool falloff = true;                // Radial / Vortex fade out linearly towards the inscribed circle
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+#include "utils/EntityTypes.h"
+#include "utils/Vector.h"
+
+enum class JointType : uint8_t {
+    Distance,  // keeps the anchors exactly `length` apart (rigid rod)
+    Spring,    // soft distance: pulls towards `length` with `stiffness` / `damping`
+    Pin,       // anchors coincide (revolute - bodies don't rotate, so a shared point)
+    Rope       // anchors at most `length` apart, slack below that
+};
+
+// Connects the owning entity (body A) to `other` (body B)
+struct JointComponent {
+    JointType type = JointType::Distance;
+    EntityID other = 0;
+
+    VectorFloat anchorA{0.0f, 0.0f};  // offsets from the transforms
+    VectorFloat anchorB{0.0f, 0.0f};
+
+    float length = 0.0f;     // rest / max length in px
+    float stiffness = 0.0f;  // Spring: force per px of stretch
+    float damping = 0.0f;    // Spring: force per px/s along the joint
+
+    VectorFloat impulse{0.0f, 0.0f};  // accumulated last frame (warm starting), written by the solver
+};
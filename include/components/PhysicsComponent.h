@@ -1,5 +1,7 @@
 #pragma once
 
+#include "utils/Vector.h"
+
 struct PhysicsComponent {
     float mass = 1.0f;
     float invMass = 1.0f; // 1/mass (0 for infinite mass)
@@ -19,8 +21,19 @@ struct PhysicsComponent {
 
     bool isGrounded = false;
 
+    // Sleeping - resting bodies are skipped by physics and static in the broadphase
+    bool canSleep = true;
+    bool isSleeping = false;
+    int restFrames = 0;          // consecutive frames under the sleep speed
+    VectorFloat restPosition;    // where it fell asleep (moving it wakes it up)
+
     void SetMass(float m) {
         mass = m;
         invMass = (m == 0.0f ? 0.0f : 1.0f / m);
     }
+
+    void Wake() {
+        isSleeping = false;
+        restFrames = 0;
+    }
 };
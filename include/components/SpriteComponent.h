@@ -7,11 +7,27 @@ struct SpriteComponent {
     Texture* texture = nullptr;
     int width = 0;
     int height = 0;
+    int layer = 0;   // drawn back to front, lower first
+    bool ySort = false;  // within the layer, sprites lower in the world draw on top
+    SDL_Rect srcRect{0, 0, 0, 0};  // part of the texture (atlas page), w == 0: whole texture
 
     void SetTexture(Texture* tex) {
         texture = tex;
+        srcRect = {0, 0, 0, 0};
         if (texture) {
             SDL_QueryTexture(texture->GetSDLTexture(), NULL, NULL, &width, &height);
         }
     }
+
+    // Atlas region: sized like the region, not the page
+    void SetTexture(Texture* tex, const SDL_Rect& region) {
+        if (region.w <= 0 || region.h <= 0) {
+            SetTexture(tex);
+            return;
+        }
+        texture = tex;
+        srcRect = region;
+        width = region.w;
+        height = region.h;
+    }
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IComponentStorage.h"
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -9,7 +10,7 @@ class ComponentStorage : public IComponentStorage {
 public:
     // Add, get, check and remove (m_components)
     void Add(EntityID id, const T& component) {
-        m_components[id] = component;
+        if (m_components.insert_or_assign(id, component).second) ++m_version;
     }
 
     T* Get(EntityID id) {
@@ -17,6 +18,11 @@ public:
         return it != m_components.end() ? &it->second : nullptr;
     }
 
+    const T* Get(EntityID id) const {
+        auto it = m_components.find(id);
+        return it != m_components.end() ? &it->second : nullptr;
+    }
+
     bool Has(EntityID id) const {
         return m_components.find(id) != m_components.end();
     }
@@ -25,6 +31,7 @@ public:
         auto it = m_components.find(id);
         if (it != m_components.end()) {
             m_components.erase(it);
+            ++m_version;
         }
     }
 
@@ -32,6 +39,13 @@ public:
         return m_components;
     }
 
+    // Bumped whenever a component is added or removed (not on overwrite).
+    // Component pointers stay valid until the version changes.
+    uint64_t GetVersion() const {
+        return m_version;
+    }
+
 private:
     std::unordered_map<EntityID, T> m_components;
+    uint64_t m_version = 0;
 };
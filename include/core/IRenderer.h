@@ -7,4 +7,11 @@ class IRenderer {
 public:
     virtual ~IRenderer() = default;
     virtual void DrawTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect* dstRect) = 0;
+
+    // Indexed triangles in screen space, texture may be nullptr for vertex colours only
+    virtual void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                              const int* indices, int numIndices) = 0;
+
+    // Debug overlays
+    virtual void DrawLine(int x1, int y1, int x2, int y2, SDL_Color color) = 0;
 };
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+    Small fixed-size worker pool for data-parallel loops.
+    ParallelFor splits [0, count) into chunks and blocks until all of them are done.
+    The calling thread works on chunks too, so a pool with 0 workers runs everything inline.
+    Chunk indices are stable for a given (count, grain), so callers can keep
+    per-chunk output buffers and merge them in chunk order for deterministic results.
+*/
+class JobSystem {
+public:
+    using ChunkFn = std::function<void(size_t begin, size_t end, size_t chunk)>;
+
+    explicit JobSystem(unsigned workers = DefaultWorkerCount()) {
+        for (unsigned i = 0; i < workers; ++i) {
+            m_workers.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers) worker.join();
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    static unsigned DefaultWorkerCount() {
+        const unsigned hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 0;
+    }
+
+    size_t GetWorkerCount() const { return m_workers.size(); }
+
+    // Number of chunks ParallelFor will use (about `grain` items each, at most 4 chunks per thread)
+    size_t ChunkCount(size_t count, size_t grain) const {
+        if (count == 0) return 0;
+        const size_t threads = m_workers.size() + 1;
+        const size_t byGrain = (count + grain - 1) / std::max<size_t>(grain, 1);
+        return std::max<size_t>(1, std::min(byGrain, threads * 4));
+    }
+
+    void ParallelFor(size_t count, size_t grain, const ChunkFn& fn) {
+        const size_t chunks = ChunkCount(count, grain);
+        if (chunks == 0) return;
+        if (chunks == 1 || m_workers.empty()) {
+            RunInline(count, chunks, fn);
+            return;
+        }
+
+        const size_t chunkSize = (count + chunks - 1) / chunks;
+        size_t remaining = chunks;  // guarded by m_mutex
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                const size_t begin = chunk * chunkSize;
+                const size_t end = std::min(count, begin + chunkSize);
+                m_queue.push_back([this, &fn, &remaining, begin, end, chunk] {
+                    fn(begin, end, chunk);
+                    // Under the lock, so the caller can't return before we're done with `remaining`
+                    std::lock_guard<std::mutex> done(m_mutex);
+                    if (--remaining == 0) m_done.notify_all();
+                });
+            }
+        }
+        m_wake.notify_all();
+
+        // Help out until the queue is empty, then sleep until the chunks still on workers finish
+        while (RunOne()) {}
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [&remaining] { return remaining == 0; });
+    }
+
+private:
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;  // a ParallelFor's last chunk finished
+    bool m_stopping = false;
+
+    void RunInline(size_t count, size_t chunks, const ChunkFn& fn) {
+        const size_t chunkSize = (count + chunks - 1) / chunks;
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            const size_t begin = chunk * chunkSize;
+            fn(begin, std::min(count, begin + chunkSize), chunk);
+        }
+    }
+
+    bool RunOne() {
+        std::function<void()> job;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_queue.empty()) return false;
+            job = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        job();
+        return true;
+    }
+
+    void WorkerLoop() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+                if (m_stopping && m_queue.empty()) return;
+                job = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+            job();
+        }
+    }
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "../core/Event.h"
+#include "../../utils/EntityTypes.h"
+
+enum class TriggerPhase {
+    Enter,
+    Exit
+};
+
+struct TriggerEvent : public Event {
+    EntityID trigger;
+    EntityID other;
+    TriggerPhase phase;
+
+    explicit TriggerEvent(EntityID trigger, EntityID other, TriggerPhase phase)
+        : trigger{trigger}, other{other}, phase{phase} {}
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Where a rectangle landed
+struct AtlasSlot {
+    int page = 0;
+    int x = 0;
+    int y = 0;
+};
+
+/*
+    Skyline bottom-left rectangle packer over fixed-size pages.
+    Each page keeps its top outline as horizontal segments; a rectangle goes where its
+    top edge ends lowest (ties: narrower segment). A new page opens when no page fits.
+    Pure bookkeeping - the AssetManager copies the pixels.
+*/
+class AtlasPacker {
+public:
+    AtlasPacker(int pageWidth, int pageHeight);
+
+    // False if the rectangle is larger than a page
+    bool Insert(int width, int height, AtlasSlot& slot);
+
+    int GetPageCount() const;
+    int GetUsedHeight(int page) const;  // lowest point reached on the page
+    int GetPageWidth() const;
+    int GetPageHeight() const;
+
+private:
+    struct Segment {
+        int x, y, width;
+    };
+
+    struct Page {
+        std::vector<Segment> skyline;
+        int usedHeight = 0;
+    };
+
+    int m_pageWidth;
+    int m_pageHeight;
+    std::vector<Page> m_pages;
+
+    bool InsertInPage(Page& page, int width, int height, int& x, int& y) const;
+    int FitAt(const Page& page, std::size_t index, int width, int height) const;  // y, or -1
+    void AddLevel(Page& page, std::size_t index, int x, int y, int width, int height) const;
+};
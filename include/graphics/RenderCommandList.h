@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SDL.h"
+#include "core/IRenderer.h"
+
+/*
+    One frame of drawing recorded as data. The list is itself an IRenderer, so the
+    RenderSystem, particles and debug overlays record into it unchanged; Execute()
+    replays the calls in order on the real renderer.
+    Geometry is copied into shared vertex / index pools, so the recorder's scratch
+    buffers can be reused right after the call. Storage is kept across Clear().
+*/
+class RenderCommandList : public IRenderer {
+public:
+    // IRenderer - recorded, not drawn
+    void DrawTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect* dstRect) override;
+    void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                      const int* indices, int numIndices) override;
+    void DrawLine(int x1, int y1, int x2, int y2, SDL_Color color) override;
+
+    void Execute(IRenderer& renderer) const;
+    void Clear();
+
+    size_t GetCommandCount() const;
+    size_t GetVertexCount() const;
+
+private:
+    enum class CommandType : uint8_t { Texture, Geometry, Line };
+
+    struct Command {
+        CommandType type;
+        bool hasSrc;
+        SDL_Texture* texture;
+        SDL_Rect src;           // Texture
+        SDL_Rect dst;           // Texture; Line: x1, y1, x2, y2
+        SDL_Color color;        // Line
+        uint32_t firstVertex;   // Geometry
+        uint32_t vertexCount;
+        uint32_t firstIndex;
+        uint32_t indexCount;
+    };
+
+    std::vector<Command> m_commands;
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+};
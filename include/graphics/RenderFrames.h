@@ -0,0 +1,49 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+#include "graphics/RenderCommandList.h"
+
+/*
+    Hand-off of RenderCommandLists between the simulation and the thread that owns the SDL
+    renderer. The simulation records frame N+1 into the back list while the render side
+    executes and presents frame N from the front list. A third list keeps the last released
+    frame, so the render side can present it again while the simulation is slow.
+
+    Simulation:  RenderCommandList& list = frames.BeginRecord(); ...record...; frames.Publish();
+    Render:      if (auto* list = frames.TryAcquire()) { list->Execute(renderer); frames.Release(); }
+                 else frames.GetLast().Execute(renderer);
+
+    Publish() waits until the render side has released the previous frame, so no frame is
+    dropped and neither side ever touches the list the other is using.
+*/
+class RenderFrames {
+public:
+    RenderCommandList& BeginRecord();  // back list, cleared
+    void Publish();                    // back becomes front
+
+    // Blocks until a new frame is published; nullptr once stopped
+    const RenderCommandList* Acquire();
+    // Never blocks; nullptr when no new frame is published (the window keeps polling events)
+    const RenderCommandList* TryAcquire();
+    void Release();  // the released list becomes GetLast()
+
+    // Render side only: the last released frame, empty before the first
+    const RenderCommandList& GetLast() const;
+
+    // Wakes both sides for shutdown
+    void Stop();
+
+private:
+    RenderCommandList m_lists[3];
+    int m_front = 0;
+    int m_back = 1;
+    int m_last = 2;              // only the render side changes it (Release)
+    bool m_frontReady = false;  // published, not yet acquired
+    bool m_reading = false;     // acquired, not yet released
+    bool m_stopped = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+};
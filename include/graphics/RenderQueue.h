@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "SDL.h"
+#include "core/IRenderer.h"
+#include "utils/RadixSort.h"
+
+struct RenderQueueStats {
+    size_t quads = 0;
+    size_t batches = 0;        // DrawGeometry calls in the last Flush
+    bool sortSkipped = false;  // keys matched the previous frame, last order reused
+};
+
+/*
+    Sprite quads collected over a frame and drawn in as few calls as possible.
+    Every quad gets a 64-bit key: layer (16 bits), y-sort (24 bits), texture (24 bits).
+    Flush() orders the quads with a stable radix sort on the key (submission order breaks ties)
+    and emits one DrawGeometry call per run of equal layer and texture.
+    When the key sequence matches the previous frame the sort is skipped and the last order reused.
+    Vertex and index buffers are kept between frames; the index buffer only ever grows.
+*/
+class RenderQueue {
+public:
+    // Screen-space destination; uv is the normalised source rect (whole texture by default).
+    // sortY: within a layer, higher values draw later (y-sorted sprites pass their world-space
+    // bottom edge so camera movement doesn't change the keys); 0 keeps texture grouping.
+    void Push(SDL_Texture* texture, int layer, const SDL_FRect& dst,
+              const SDL_FRect& uv = {0.0f, 0.0f, 1.0f, 1.0f}, float sortY = 0.0f,
+              SDL_Color color = {255, 255, 255, 255});
+
+    void Flush(IRenderer* renderer);  // draws and clears
+    void Clear();
+
+    size_t Size() const;
+    const RenderQueueStats& GetStats() const;
+
+private:
+    struct Quad {
+        SDL_Texture* texture;
+        int layer;
+        SDL_FRect dst;
+        SDL_FRect uv;
+        SDL_Color color;
+    };
+
+    std::vector<Quad> m_quads;
+    std::vector<uint64_t> m_keys;       // this frame, submission order
+    std::vector<uint64_t> m_lastKeys;   // previous frame
+    std::vector<SortItem> m_order;      // sorted (key, quad index), reused when keys repeat
+    std::vector<SortItem> m_scratch;
+    std::unordered_map<SDL_Texture*, uint32_t> m_textureIds;  // first-seen order, stable across frames
+
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+    RenderQueueStats m_stats;
+
+    uint64_t MakeKey(SDL_Texture* texture, int layer, float sortY);
+    void Sort();
+    void EmitRun(IRenderer* renderer, size_t begin, size_t end);
+};
@@ -23,6 +23,8 @@ public:
 
     // IRenderer method
     void DrawTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect* dstRect) override;
+    void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                      const int* indices, int numIndices) override;
 
     // Extended drawing
     void DrawTextureEx(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect* dstRect,
@@ -31,6 +33,7 @@ public:
     void DrawPoint(int x, int y);
 
     void DrawLine(int x1, int y1, int x2, int y2);
+    void DrawLine(int x1, int y1, int x2, int y2, SDL_Color color) override;  // keeps the current draw colour
     void DrawRect(const SDL_Rect& rect, bool filled = false);
 
     // Logical size / scaling
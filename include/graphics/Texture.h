@@ -10,12 +10,20 @@ public:
 
     // Load texture from file and unload
     bool LoadFromFile(const std::string& path, SDL_Renderer* renderer);
+    bool LoadFromSurface(SDL_Surface* surface, SDL_Renderer* renderer);  // surface stays owned by the caller
     void Unload();
 
     // Getter and setter
     virtual SDL_Texture* GetSDLTexture() const;
     void SetSDLTexture(SDL_Texture* tex);
 
+    // Pixel size, 0 until loaded
+    int GetWidth() const;
+    int GetHeight() const;
+    void SetSize(int width, int height);
+
 private:
     SDL_Texture* m_texture;
+    int m_width = 0;
+    int m_height = 0;
 };
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "SDL.h"
+#include "core/IRenderer.h"
+#include "level_manager/AssetManager.h"
+#include "utils/Vector.h"
+
+struct LevelData;
+
+struct TilemapStats {
+    size_t chunks = 0;  // chunks with at least one tile
+    size_t dirty = 0;   // waiting for Bake
+    size_t baked = 0;   // rendered by the last Bake
+    size_t drawn = 0;   // blits in the last Draw
+};
+
+/*
+    Static tile layer drawn from pre-rendered chunks instead of one quad per tile.
+    The map is split into square chunks (512 px by default). Bake() renders each dirty chunk
+    into its own SDL_TEXTUREACCESS_TARGET texture once; Draw() then blits only the chunks that
+    overlap the camera rectangle, so a screen full of tiles costs a handful of DrawTexture calls.
+    SetTile marks just the chunk it touches as dirty.
+
+    Bake needs the SDL renderer and so the thread that owns it. With a render thread, call it
+    every frame before executing the frame's command list (a no-op when nothing is dirty), and
+    MarkAllDirty on SDL_RENDER_TARGETS_RESET from the same thread. Draw on the simulation
+    thread only reads the chunk textures, so the two may overlap; SetTile must not run while
+    Bake does, so edit tiles at load time or hand the edits to the render thread.
+
+    JSON (the same file as the TileCollisionMap, "tileset" and "tiles" are extra):
+    {
+        "tileSize": 32,
+        "origin": [0, 592],
+        "tileset": { "texture": "block", "tileSize": 64 },
+        "tiles": { "#": 0, "=": 1 },
+        "rows": [ "....==....", "##########" ]
+    }
+    "tiles" maps a row character to a cell of the tileset, counted left to right, top to bottom.
+    Characters without an entry are empty.
+*/
+class TilemapRenderer {
+public:
+    explicit TilemapRenderer(int chunkSize = 512);
+    ~TilemapRenderer();
+
+    TilemapRenderer(const TilemapRenderer&) = delete;
+    TilemapRenderer& operator=(const TilemapRenderer&) = delete;
+
+    bool LoadFromFile(const std::string& path, const AssetManager& assets);
+    bool LoadFromJson(const nlohmann::json& j, const AssetManager& assets);
+    bool LoadLevel(const LevelData& level, const AssetManager& assets);  // LevelData::tilemapPath
+
+    // Clears the map; every chunk texture is released
+    void Resize(int width, int height, int tileSize, VectorFloat origin = {0.0f, 0.0f});
+    void SetTileset(const TextureRegion& tileset, int cellSize);
+
+    void SetTile(int x, int y, int tile);  // tileset cell, -1 for empty
+    int GetTile(int x, int y) const;       // -1 outside the map
+
+    // Render targets can be lost (SDL_RENDER_TARGETS_RESET) - re-bake everything
+    void MarkAllDirty();
+
+    void Bake(SDL_Renderer* renderer);
+
+    // Viewport {0, 0} draws every chunk
+    void Draw(IRenderer* renderer, SDL_Point cameraPosition, SDL_Point viewport, float zoom);
+
+    bool IsLoaded() const;
+    int GetChunkTiles() const;  // tiles along one chunk side
+    int GetChunkCountX() const;
+    int GetChunkCountY() const;
+    const TilemapStats& GetStats() const;
+
+private:
+    struct Chunk {
+        SDL_Texture* texture = nullptr;
+        int width = 0;   // px, edge chunks are smaller
+        int height = 0;
+        int tiles = 0;   // non-empty tiles
+        bool dirty = false;
+    };
+
+    int m_chunkSize;
+    int m_width = 0;
+    int m_height = 0;
+    int m_tileSize = 32;
+    int m_chunkTiles = 1;
+    int m_chunksX = 0;
+    int m_chunksY = 0;
+    VectorFloat m_origin{0.0f, 0.0f};
+
+    std::vector<int16_t> m_tiles;
+    std::vector<Chunk> m_chunks;
+
+    TextureRegion m_tileset;
+    int m_cellSize = 32;
+
+    TilemapStats m_stats;
+
+    Chunk& ChunkAt(int x, int y);  // chunk holding tile (x, y)
+    bool BakeChunk(SDL_Renderer* renderer, int cx, int cy);
+    bool CellRect(int tile, SDL_Rect& rect) const;  // source rect in the tileset texture
+    void ReleaseChunks();
+};
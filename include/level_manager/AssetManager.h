@@ -2,20 +2,53 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
+
+#include "SDL.h"
 
 class Renderer;
 class Texture;
 
+// Scene "assets": { "atlas": { ... } }
+struct AtlasSettings {
+    bool enabled = false;
+    int pageSize = 2048;      // square pages, px
+    int padding = 2;          // transparent border around each image, stops filtering bleed
+    int maxImageSize = 512;   // larger images stay standalone textures
+};
+
+// A texture plus the part of it to draw; rect.w == 0 means the whole texture
+struct TextureRegion {
+    Texture* texture = nullptr;
+    SDL_Rect rect{0, 0, 0, 0};
+};
+
 class AssetManager {
 public:
     explicit AssetManager(Renderer* renderer);
     ~AssetManager();
 
     bool LoadTexture(const std::string& key, const std::string& path);
-    Texture* GetTexture(const std::string& key) const;
+    Texture* GetTexture(const std::string& key) const;  // atlas page for packed images
     void UnloadAll();
 
+    // Atlas: queue images, then pack them into a few large pages in one go
+    void QueueAtlasImage(const std::string& key, const std::string& path);
+    bool BuildAtlas(const AtlasSettings& settings);
+
+    TextureRegion GetRegion(const std::string& key) const;
+    size_t GetAtlasPageCount() const;
+
 private:
+    struct PendingImage {
+        std::string key;
+        std::string path;
+    };
+
     Renderer* m_renderer;
     std::unordered_map<std::string, std::unique_ptr<Texture>> m_textures;
+
+    std::vector<PendingImage> m_pending;
+    std::vector<std::unique_ptr<Texture>> m_atlasPages;
+    std::unordered_map<std::string, TextureRegion> m_regions;  // packed images only
 };
@@ -3,6 +3,7 @@
 #include <string>
 #include <nlohmann/json.hpp>
 
+#include "level_manager/LevelData.h"
 #include "utils/CollisionLayer.h"
 #include "utils/SurfaceTypes.h"
 
@@ -57,6 +58,11 @@ public:
     bool LoadScene(const std::string& path);
     void UnloadScene();
 
+    // Optional "tilemap" entry of the last scene (empty if none)
+    const std::string& GetTilemapPath() const;
+    // Optional "level" entry of the last scene (gravity, ambientWindX / Y), defaults if none
+    const LevelData& GetLevel() const;
+
 private:
     Renderer* m_renderer;
     EntityCreationSystem* m_ecs;
@@ -77,6 +83,8 @@ private:
     ComponentStorage<AnimationComponent>* m_animations;
 
     json m_prefabs;
+    std::string m_tilemapPath;
+    LevelData m_level;
 
     void LoadAssets(const json& j);
     void LoadPrefabs(const json& j);
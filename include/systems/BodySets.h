@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/ComponentStorage.h"
+#include "components/TransformComponent.h"
+#include "components/VelocityComponent.h"
+#include "components/AccelerationComponent.h"
+#include "components/PhysicsComponent.h"
+
+// Velocity + transform, no PhysicsComponent - moved by the MovementSystem
+struct KinematicBody {
+    EntityID id;
+    TransformComponent* transform;
+    VelocityComponent* velocity;
+    const AccelerationComponent* acceleration;  // shared zero acceleration when the entity has none
+};
+
+// PhysicsComponent + transform - integrated by the PhysicsSystem
+struct DynamicBody {
+    EntityID id;
+    PhysicsComponent* phys;
+    TransformComponent* transform;
+    const AccelerationComponent* acceleration;  // shared zero acceleration when the entity has none
+};
+
+/*
+    Kinematic or dynamic bodies as a contiguous array of component pointers, sorted by id.
+    Each owner builds only the set it iterates: with a velocity storage it is the kinematic
+    set (MovementSystem), without one the dynamic set (PhysicsSystem); the other stays empty.
+    The set is rebuilt only when a component is added to / removed from one of the storages
+    (ComponentStorage::GetVersion), so the per-frame loops do no hash lookups or membership probes.
+    Component pointers stay valid between rebuilds (unordered_map nodes don't move).
+*/
+class BodySets {
+public:
+    BodySets(ComponentStorage<TransformComponent>& transforms,
+             ComponentStorage<AccelerationComponent>& accelerations,
+             ComponentStorage<PhysicsComponent>& physics,
+             ComponentStorage<VelocityComponent>* velocities = nullptr);  // kinematic set instead of dynamic
+
+    // Rebuilds the set if any storage it reads changed; returns true if it did
+    bool Refresh();
+
+    const std::vector<KinematicBody>& GetKinematic() const;
+    const std::vector<DynamicBody>& GetDynamic() const;
+
+private:
+    ComponentStorage<TransformComponent>& m_transforms;
+    ComponentStorage<AccelerationComponent>& m_accelerations;
+    ComponentStorage<PhysicsComponent>& m_physics;
+    ComponentStorage<VelocityComponent>* m_velocities;
+
+    std::vector<KinematicBody> m_kinematic;
+    std::vector<DynamicBody> m_dynamic;
+
+    uint64_t m_versions[4] = {};
+    bool m_built = false;
+
+    void RebuildDynamic();
+    void RebuildKinematic();
+};
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <SDL2/SDL.h>
+
 #include "core/ISystem.h"
-#include "window/Window.h"
 #include "core/ComponentStorage.h"
 #include "components/BoundryComponent.h"
 #include "components/TransformComponent.h"
@@ -12,7 +14,7 @@ public:
     BoundrySystem(ComponentStorage<TransformComponent>& transforms,
                   ComponentStorage<BoundryComponent>& boundaries,
                   ComponentStorage<PhysicsComponent>& physics,
-                  Window* window);
+                  const std::atomic<SDL_Point>* screenSize);  // written by the thread that polls the window
 
     void Update(float deltaTime) override;
 
@@ -20,5 +22,5 @@ private:
     ComponentStorage<TransformComponent>& m_transforms;
     ComponentStorage<BoundryComponent>& m_boundaries;
     ComponentStorage<PhysicsComponent>& m_physics;
-    Window* m_window;
+    const std::atomic<SDL_Point>* m_screenSize;
 };
\ No newline at end of file
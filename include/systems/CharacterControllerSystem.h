@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core/ISystem.h"
+#include "core/ComponentStorage.h"
+#include "components/CharacterControllerComponent.h"
+#include "components/ColliderComponent.h"
+#include "components/TransformComponent.h"
+#include "utils/SweptAABB.h"
+
+#include <utility>
+#include <vector>
+
+class SpatialQuery;
+class TileCollisionMap;
+
+// Counters of the last Update
+struct CharacterControllerStats {
+    size_t controllers = 0;
+    size_t sweeps = 0;  // broadphase sweeps (2 per walker on open ground)
+};
+
+/*
+    Kinematic character movement without rigid-body simulation.
+    Each frame a walker is moved X first, then Y, with one swept query per axis against the
+    CollisionSystem broadphase (through SpatialQuery) and the tile map: it stops at the first
+    hit and keeps the motion along the surface (collide-and-slide).
+
+    Extra queries only run when needed:
+    - step-up: blocked sideways on the ground -> up by stepHeight, across, back down
+    - ground snap: walked off the ground without jumping -> down by snapDistance
+
+    Slopes steeper than maxSlope block like walls. Jumps are accepted for coyoteTime after
+    leaving the ground. Register after the CollisionSystem so the broadphase is current.
+
+    Walkers stop at the surface and never overlap what they hit, so the CollisionSystem does
+    not pair them; the broadphase colliders they ran into are listed by GetContacts instead.
+*/
+class CharacterControllerSystem : public ISystem {
+public:
+    CharacterControllerSystem(ComponentStorage<TransformComponent>& transforms,
+                              ComponentStorage<ColliderComponent>& colliders,
+                              ComponentStorage<CharacterControllerComponent>& controllers);
+
+    void Update(float deltaTime) override;  // ISystem method
+
+    // Collision sources (either is optional)
+    void SetSpatialQuery(const SpatialQuery* spatialQuery);
+    void SetTileMap(const TileCollisionMap* tileMap);
+
+    // (walker, collider) hit by the walkers' moves during the last Update
+    const std::vector<std::pair<EntityID, EntityID>>& GetContacts() const;
+    const CharacterControllerStats& GetStats() const;
+
+private:
+    // What blocked one move
+    struct MoveResult {
+        VectorFloat delta;
+        bool blockedX = false;
+        bool blockedUp = false;
+        bool blockedDown = false;
+        EntityID other = INVALID_ENTITY;  // broadphase collider hit (tile map hits have none)
+    };
+
+    ComponentStorage<TransformComponent>& m_transforms;
+    ComponentStorage<ColliderComponent>& m_colliders;
+    ComponentStorage<CharacterControllerComponent>& m_controllers;
+
+    const SpatialQuery* m_spatialQuery = nullptr;
+    const TileCollisionMap* m_tileMap = nullptr;
+    CharacterControllerStats m_stats;
+    std::vector<std::pair<EntityID, EntityID>> m_contacts;
+
+    void Step(EntityID id, CharacterControllerComponent& controller, TransformComponent& transform,
+              const ColliderComponent& collider, float deltaTime);
+    MoveResult Move(EntityID id, const AABB& box, const VectorFloat& delta, CollisionLayer mask);
+    bool StepUp(EntityID id, AABB& box, float dx, float blockedDx, float stepHeight, CollisionLayer mask);
+    bool IsTooSteep(const VectorFloat& delta, float maxSlope) const;
+    void AddContact(EntityID id, const MoveResult& move);
+};
@@ -3,12 +3,17 @@
 #include "core/ISystem.h"
 #include "core/EntityManager.h"
 #include "core/ComponentStorage.h"
+#include "core/JobSystem.h"
 #include "components/ColliderComponent.h"
 #include "components/TransformComponent.h"
+#include "components/PhysicsComponent.h"
 #include "event/core/EventBus.h"
 #include "event/custom_events/CollisionEvent.h"
 #include "utils/Int2.h"
 #include "utils/SpatialGrid.h"
+#include "utils/SweptAABB.h"
+#include "utils/AABBKernel.h"
+#include "utils/LayerMatrix.h"
 
 // Hash std::pair<EntityID, EntityID>
 struct PairHash {
@@ -17,6 +22,24 @@ struct PairHash {
     }
 };
 
+// Counters of the last Update (for benchmarks / debug overlays)
+struct CollisionStats {
+    size_t colliders = 0;        // all proxies, sleeping included
+    size_t staticColliders = 0;  // sleeping proxies
+    size_t candidatePairs = 0;   // pairs handed to the narrowphase
+    size_t collisions = 0;       // pairs that overlap
+    bool staticRebuilt = false;
+};
+
+// Broadphase snapshot of one collider (awake ones are rebuilt every Update)
+struct ColliderProxy {
+    EntityID id;
+    AABB bounds;
+    CollisionLayer layer;
+    CollisionLayer mask;
+    uint8_t bucket;  // LayerMatrix bucket of `layer`
+};
+
 class CollisionSystem : public ISystem {
 public:
     CollisionSystem(EntityManager& entityManager,
@@ -26,18 +49,81 @@ public:
     void Update(float deltaTime) override; // ISystem method
 
     const std::vector<std::pair<EntityID, EntityID>>& GetCollisions() const;
+    const CollisionStats& GetStats() const;
+
+    // Continuous collision (CCD) - swept test of a continuous collider against the broadphase.
+    // Returns the earliest hit along `delta`. Slow movers (|delta| under half the collider size) skip it.
+    // Candidates come from the last Update's grids, but are tested at their current position.
+    bool Sweep(EntityID id, const VectorFloat& delta, SweepHit& hit);
+
+    // Contacts found outside of Update (e.g. by CCD in the integrator). Kept apart from
+    // GetCollisions, so Update doesn't drop them; the reporter clears them once per step.
+    void ReportContact(EntityID a, EntityID b);
+    const std::vector<std::pair<EntityID, EntityID>>& GetSweptContacts() const;
+    void ClearSweptContacts();
+
+    // Narrowphase runs on the pool when set (results don't depend on the thread count)
+    void SetJobSystem(JobSystem* jobSystem);
+
+    // Sleeping bodies are static in the broadphase - kept in their own grid and never paired with each other
+    void SetPhysics(const ComponentStorage<PhysicsComponent>* physics);
+    void InvalidateStaticBodies();  // a body fell asleep or woke up
+
+    // Read-only broadphase data for spatial queries (valid until the next Update)
+    const std::vector<ColliderProxy>& GetProxies() const;  // sleeping first, then awake
+    const SpatialGrid<size_t>& GetGrid() const;            // awake colliders
+    const SpatialGrid<size_t>& GetStaticGrid() const;      // sleeping colliders
+
+    // Visit proxy indices of both grids in one cell
+    template<typename Visitor>
+    void ForEachInCell(int cx, int cy, Visitor&& visit) const {
+        for (size_t index : m_staticGrid.Query(cx, cy)) visit(index);
+        for (size_t index : m_spatialGrid.Query(cx, cy)) visit(index);
+    }
 
 private:
-    // Check that entities are colliding
-    bool IsColliding(int ax, int ay, int aw, int ah,
-                     int bx, int by, int bw, int bh);
-    
-    // Collision handling between entities
-    void CheckAndHandleCollision(EntityID a, EntityID b);
+    // Narrowphase over m_candidates - no storage lookups, SIMD overlap kernel
+    void Narrowphase();
+
+    // Pair de-duplication across cells
+    static bool IsOwnerCell(const Int2& cell, const AABB& a, const AABB& b, int cellSize);
+
+    // Range of one layer bucket inside a cell list
+    struct BucketRun {
+        size_t begin, end;
+        uint8_t bucket;
+    };
+    void BuildRuns(const std::vector<size_t>& list, std::vector<BucketRun>& runs) const;
+    void TestRuns(const Int2& cell,
+                  const std::vector<size_t>& listA, const std::vector<BucketRun>& runsA,
+                  const std::vector<size_t>& listB, const std::vector<BucketRun>& runsB,
+                  bool sameList);
+
+    bool IsSleeping(EntityID id) const;
+    ColliderProxy MakeProxy(EntityID id, const TransformComponent& t, const ColliderComponent& c) const;
+    void InsertToGrid(SpatialGrid<size_t>& grid, size_t index);
+    void RebuildStatic(size_t staticCount);
 
     EntityManager& m_entityManager;
     ComponentStorage<TransformComponent>& m_transforms;
     ComponentStorage<ColliderComponent>& m_colliders;
-    SpatialGrid<EntityID> m_spatialGrid;
+    SpatialGrid<size_t> m_spatialGrid;  // cell -> indices into m_proxies
+    std::vector<ColliderProxy> m_proxies;  // each part sorted by layer bucket
+    LayerMatrix m_layerMatrix;
+
+    // Sleeping colliders: m_proxies[0, m_staticCount), only rebuilt when the sleeping set changes
+    const ComponentStorage<PhysicsComponent>* m_physics = nullptr;
+    SpatialGrid<size_t> m_staticGrid;
+    LayerMatrix m_staticLayers;
+    size_t m_staticCount = 0;
+    bool m_staticDirty = false;
     std::vector<std::pair<EntityID, EntityID>> m_collisions;
+    std::vector<std::pair<EntityID, EntityID>> m_sweptContacts;
+    CollisionStats m_stats;
+
+    // Narrowphase
+    static constexpr size_t NARROWPHASE_GRAIN = 1024;  // about this many pairs per chunk
+    JobSystem* m_jobSystem = nullptr;
+    std::vector<std::pair<uint32_t, uint32_t>> m_candidates;  // proxy index pairs from the broadphase
+    std::vector<std::vector<std::pair<EntityID, EntityID>>> m_chunkHits;
 };
\ No newline at end of file
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "core/ComponentStorage.h"
+#include "core/JobSystem.h"
+#include "components/ColliderComponent.h"
+#include "components/JointComponent.h"
+#include "components/PhysicsComponent.h"
+#include "components/TransformComponent.h"
+#include "systems/CollisionSystem.h"
+#include "utils/UnionFind.h"
+
+// Counters of the last Solve
+struct SolverStats {
+    size_t bodies = 0;
+    size_t contacts = 0;
+    size_t joints = 0;
+    size_t warmStarted = 0;  // contacts that reused last frame's impulses
+    size_t colors = 0;       // constraint colours (graph colouring only)
+    size_t islands = 0;      // independent islands (island solving only)
+};
+
+/*
+    Sequential-impulse contact solver.
+    Every CollisionSystem pair becomes an AABB contact (normal along the axis of least
+    penetration). Each iteration solves friction, then the non-penetration impulse of every
+    contact, clamping the accumulated impulses. Accumulated impulses are cached per pair and
+    applied first next frame (warm starting), so stacks converge over frames at a fixed cost
+    of `iterations` passes per contact.
+
+    Joints (JointComponent) are solved in the same iterations, after the contacts. They are
+    gathered into one contiguous array sorted by body and warm started from JointComponent::impulse.
+
+    With graph colouring on, contacts and joints are split into colours that share no dynamic
+    body; each colour is solved as one batch, in parallel when a JobSystem is set.
+
+    With island solving on, contacts and joints are grouped into islands (union-find over the
+    dynamic bodies they connect; static bodies don't link islands). Every island runs all its
+    iterations as one job. Islands share no dynamic body, so the result is the same as the
+    serial solve, whatever the thread count.
+
+    Sleeping bodies and colliders without a PhysicsComponent are static (infinite mass).
+*/
+class ConstraintSolver {
+public:
+    ConstraintSolver(ComponentStorage<TransformComponent>& transforms,
+                     ComponentStorage<ColliderComponent>& colliders,
+                     ComponentStorage<PhysicsComponent>& physics);
+
+    // Changes PhysicsComponent::velocity of the dynamic bodies in `pairs`
+    void Solve(const std::vector<std::pair<EntityID, EntityID>>& pairs, float deltaTime);
+
+    // Contacts only, for a subset of the pairs (adaptive physics substeps): joints are skipped and
+    // cached impulses of pairs not in `pairs` are kept for the next Solve
+    void SolveSubstep(const std::vector<std::pair<EntityID, EntityID>>& pairs, float deltaTime);
+
+    void SetIterations(int iterations);
+    // Position drift correction: `beta` of the penetration deeper than `slop` px is removed per step
+    void SetBaumgarte(float beta, float slop);
+    void SetWarmStarting(bool enabled);
+
+    // Joints between bodies (optional)
+    void SetJoints(ComponentStorage<JointComponent>* joints);
+
+    // Solve constraints of one colour in parallel (results depend on the colouring, not the thread count)
+    void SetGraphColoring(bool enabled);
+    void SetJobSystem(JobSystem* jobSystem);
+
+    // Solve independent islands as parallel jobs (takes precedence over graph colouring)
+    void SetIslandSolving(bool enabled);
+
+    // Resting on something (contact normal pointing up) during the last Solve
+    bool IsGrounded(EntityID id) const;
+    const SolverStats& GetStats() const;
+
+private:
+    struct SolverBody {
+        EntityID id;
+        PhysicsComponent* phys;  // null for static colliders
+        VectorFloat velocity;
+        float invMass;
+        bool grounded;
+    };
+
+    struct Contact {
+        uint32_t a, b;           // indices into m_bodies
+        VectorFloat normal;      // from a to b
+        float penetration;
+        float normalMass;        // 1 / (invMassA + invMassB)
+        float friction;          // static or kinetic coefficient, picked from the initial sliding speed
+        float bias;              // Baumgarte velocity
+        float normalImpulse;     // accumulated
+        float tangentImpulse;
+        std::pair<EntityID, EntityID> key;
+        uint8_t color;
+    };
+
+    struct Joint {
+        uint32_t a, b;
+        JointType type;
+        VectorFloat normal;      // from anchor a to anchor b (not used by Pin)
+        float mass;              // effective mass (Spring: softened)
+        float gamma;             // Spring softness
+        VectorFloat bias;        // Pin: both axes, otherwise x only
+        VectorFloat impulse;     // accumulated (x only unless Pin)
+        JointComponent* source;
+        uint8_t color;
+    };
+
+    struct CachedImpulse {
+        VectorFloat normal;
+        float normalImpulse;
+        float tangentImpulse;
+    };
+
+    ComponentStorage<TransformComponent>& m_transforms;
+    ComponentStorage<ColliderComponent>& m_colliders;
+    ComponentStorage<PhysicsComponent>& m_physics;
+
+    int m_iterations = 8;
+    float m_beta = 0.2f;
+    float m_slop = 0.5f;  // px
+    bool m_warmStarting = true;
+
+    std::vector<SolverBody> m_bodies;
+    std::unordered_map<EntityID, uint32_t> m_bodyIndex;
+    std::vector<Contact> m_contacts;
+    std::unordered_map<std::pair<EntityID, EntityID>, CachedImpulse, PairHash> m_cache;
+    SolverStats m_stats;
+
+    ComponentStorage<JointComponent>* m_jointStorage = nullptr;
+    std::vector<std::pair<EntityID, JointComponent*>> m_jointSources;  // scratch
+    std::vector<Joint> m_joints;
+
+    // Colouring
+    static constexpr uint8_t SERIAL_COLOR = 63;  // constraints that didn't fit a colour
+    static constexpr size_t SOLVER_GRAIN = 128;
+    bool m_coloring = false;
+    JobSystem* m_jobSystem = nullptr;
+    std::vector<uint64_t> m_bodyColors;  // colours used per body
+    std::vector<size_t> m_contactColors, m_jointColors;  // offsets of each colour
+
+    // Islands
+    static constexpr size_t ISLAND_GRAIN = 4;
+    bool m_islandSolving = false;
+    UnionFind m_islandSets;
+    std::vector<uint32_t> m_islandOf;  // root body -> island index, in order of first constraint
+    std::vector<size_t> m_contactIslands, m_jointIslands;  // offsets of each island
+
+    void Run(const std::vector<std::pair<EntityID, EntityID>>& pairs, float deltaTime, bool withJoints);
+    uint32_t AddBody(EntityID id);
+    bool MakeContact(EntityID a, EntityID b, float deltaTime, Contact& contact);
+    bool MakeJoint(EntityID owner, JointComponent& source, float deltaTime, Joint& joint);
+    void ApplyImpulse(uint32_t a, uint32_t b, const VectorFloat& impulse);
+    void SolveContact(Contact& contact);
+    void SolveJoint(Joint& joint);
+
+    void SolveAll();
+    void BuildIslands();
+    void SolveIslands();
+    template<typename Constraint>
+    size_t IslandRoot(const Constraint& constraint);
+    template<typename Constraint>
+    void GroupByIsland(std::vector<Constraint>& constraints, std::vector<size_t>& offsets);
+
+    template<typename Constraint>
+    void Color(std::vector<Constraint>& constraints, std::vector<size_t>& offsets);
+    template<typename Constraint, typename SolveFn>
+    void SolveBatches(std::vector<Constraint>& constraints, const std::vector<size_t>& offsets, SolveFn solve);
+};
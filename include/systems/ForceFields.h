@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+
+#include "core/ComponentStorage.h"
+#include "components/ForceFieldComponent.h"
+#include "components/TransformComponent.h"
+#include "utils/IntegratorKernel.h"
+#include "utils/SpatialGrid.h"
+#include "utils/SweptAABB.h"
+
+struct ForceFieldStats {
+    size_t fields = 0;
+    size_t bodiesInside = 0;  // bodies that got at least one field last Apply
+    size_t evaluations = 0;   // field x body evaluations last Apply
+};
+
+/*
+    Force-field volumes sampled by the PhysicsSystem before integrating velocities.
+    Fields are kept in a grid that is rebuilt only when fields or transforms are added /
+    removed (storage versions) or a field moved or was edited. Each body looks up the one
+    cell under its point, so the cost grows with the bodies inside fields, not bodies x fields.
+    Field accelerations are added to the AccelerationComponent lanes.
+*/
+class ForceFields {
+public:
+    ForceFields(ComponentStorage<TransformComponent>& transforms,
+                ComponentStorage<ForceFieldComponent>& fields);
+
+    // Adds field accelerations to lanes [begin, end); `points` holds one sample point per lane
+    void Apply(BodyLanes& lanes, const std::vector<VectorFloat>& points, size_t begin, size_t end, float deltaTime);
+
+    // Acceleration at a single point for a body moving at `velocity`
+    VectorFloat Sample(const VectorFloat& point, const VectorFloat& velocity, float deltaTime);
+
+    // Forces a rebuild, e.g. after giving a zero-sized field a size (moves and edits are detected)
+    void InvalidateFields();
+
+    const ForceFieldStats& GetStats() const;
+
+private:
+    struct Field {
+        EntityID id;
+        AABB bounds;
+        ForceFieldComponent field;
+    };
+
+    ComponentStorage<TransformComponent>& m_transforms;
+    ComponentStorage<ForceFieldComponent>& m_fields;
+
+    SpatialGrid<size_t> m_grid;  // cell -> indices into m_volumes
+    std::vector<Field> m_volumes;
+    AABB m_extent{};             // union of all volumes, bodies outside skip the grid
+
+    uint64_t m_fieldVersion = ~0ull;
+    uint64_t m_transformVersion = ~0ull;
+    bool m_dirty = true;
+    ForceFieldStats m_stats;
+
+    void Refresh();
+    void Rebuild();
+    bool FieldsChanged() const;
+    VectorFloat Evaluate(const Field& volume, const VectorFloat& point, const VectorFloat& velocity,
+                         float deltaTime) const;
+};
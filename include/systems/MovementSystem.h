@@ -6,7 +6,9 @@
 #include "components/VelocityComponent.h"
 #include "components/AccelerationComponent.h"
 #include "components/PhysicsComponent.h"
+#include "systems/BodySets.h"
 
+// Kinematic bodies: velocity + transform without a PhysicsComponent (those belong to the PhysicsSystem)
 class MovementSystem : public ISystem {
 public:
     MovementSystem(ComponentStorage<TransformComponent>& transforms,
@@ -21,4 +23,6 @@ private:
     ComponentStorage<VelocityComponent>& m_velocities;
     ComponentStorage<AccelerationComponent>& m_accelerations;
     ComponentStorage<PhysicsComponent>& m_physics;
+
+    BodySets m_sets;
 };
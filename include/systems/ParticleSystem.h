@@ -0,0 +1,93 @@
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include "SDL.h"
+#include "core/ISystem.h"
+#include "core/IRenderer.h"
+#include "graphics/Texture.h"
+#include "utils/ParticlePool.h"
+#include "utils/Vector.h"
+
+using ParticleEmitterID = size_t;
+constexpr ParticleEmitterID INVALID_EMITTER = static_cast<ParticleEmitterID>(-1);
+
+struct ParticleEmitterConfig {
+    Texture* texture = nullptr;      // nullptr draws plain coloured quads
+    size_t capacity = 1024;          // live particles at most, spawns past it are dropped
+
+    float rate = 0.0f;               // particles per second while emitting, 0 = bursts only
+    float lifetimeMin = 0.5f, lifetimeMax = 1.0f;
+    float speedMin = 50.0f, speedMax = 100.0f;
+    float direction = -90.0f;        // degrees, -90 is up
+    float spread = 360.0f;           // degrees around direction
+
+    VectorFloat gravity{0.0f, 0.0f};
+    float drag = 0.0f;               // 1/s
+
+    float startSize = 8.0f, endSize = 0.0f;
+    float startAlpha = 1.0f, endAlpha = 0.0f;
+    SDL_Color colorMin{255, 255, 255, 255};  // tint picked per particle between the two
+    SDL_Color colorMax{255, 255, 255, 255};
+};
+
+struct ParticleStats {
+    size_t emitters = 0;
+    size_t particles = 0;   // live after the last Update
+    size_t drawCalls = 0;   // DrawGeometry calls in the last Draw
+    size_t vertices = 0;
+};
+
+/*
+    Effects particles outside the ECS: each emitter owns a fixed-capacity SoA pool that is
+    updated with SIMD and compacted with swap-remove, so 100k particles cost no entities,
+    no component lookups and no allocations after CreateEmitter.
+    Draw() builds one vertex batch per texture and submits it with a single DrawGeometry call.
+*/
+class ParticleSystem : public ISystem {
+public:
+    explicit ParticleSystem(unsigned int seed = 1337);
+
+    void Update(float deltaTime) override;  // spawn, integrate, compact
+
+    // Camera transform as in the RenderSystem: screen = (world - camera) * zoom
+    void Draw(IRenderer* renderer, const SDL_Point& camera, float zoom);
+
+    ParticleEmitterID CreateEmitter(const ParticleEmitterConfig& config, const VectorFloat& position);
+    void DestroyEmitter(ParticleEmitterID emitter);
+
+    void SetEmitterPosition(ParticleEmitterID emitter, const VectorFloat& position);
+    void SetEmitting(ParticleEmitterID emitter, bool emitting);
+    void Burst(ParticleEmitterID emitter, size_t count);
+
+    size_t GetParticleCount(ParticleEmitterID emitter) const;
+    const ParticlePool* GetPool(ParticleEmitterID emitter) const;
+    const ParticleStats& GetStats() const;
+
+private:
+    struct Emitter {
+        ParticleEmitterConfig config;
+        ParticlePool pool;
+        VectorFloat position;
+        float spawnDebt = 0.0f;  // fractional particles carried to the next frame
+        bool emitting = true;
+        bool alive = false;
+    };
+
+    std::vector<Emitter> m_emitters;  // ParticleEmitterID = index, dead slots are reused
+    std::mt19937 m_rng;
+
+    // Draw scratch, kept between frames
+    std::vector<size_t> m_drawOrder;
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+    ParticleStats m_stats;
+
+    Emitter* Find(ParticleEmitterID emitter);
+    const Emitter* Find(ParticleEmitterID emitter) const;
+
+    void Spawn(Emitter& emitter, size_t count);
+    void AppendQuads(const Emitter& emitter, const SDL_Point& camera, float zoom);
+    void Flush(IRenderer* renderer, Texture* texture);
+};
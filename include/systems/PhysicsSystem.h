@@ -5,6 +5,19 @@
 #include "components/TransformComponent.h"
 #include "components/PhysicsComponent.h"
 #include "components/AccelerationComponent.h"
+#include "components/ColliderComponent.h"
+#include "systems/BodySets.h"
+#include "utils/IntegratorKernel.h"
+#include "utils/UnionFind.h"
+
+#include <unordered_map>
+#include <vector>
+
+class CollisionSystem;
+class TileCollisionMap;
+class ConstraintSolver;
+class ForceFields;
+struct LevelData;
 
 class PhysicsSystem : public ISystem {
 public:
@@ -16,6 +29,33 @@ public:
 
     void SetGravity(float gravity);
 
+    // Level defaults: gravity and ambient wind (px/s^2 on every dynamic body)
+    void ApplyLevel(const LevelData& level);
+    void SetWind(const VectorFloat& wind);
+
+    // Regional forces - bodies sample the field volumes at their transform position
+    void SetForceFields(ForceFields* forceFields);
+
+    // Continuous collision - fast bodies with a continuous collider are clamped to their time of impact
+    void SetCollisionSystem(CollisionSystem* collisionSystem);
+    void SetContinuousThreshold(float speed);
+
+    // Contact and joint response - solves the CollisionSystem pairs and joints after integrating velocities
+    void SetConstraintSolver(ConstraintSolver* solver);
+
+    // Static level geometry - bodies with a collider are swept against the tile map
+    void SetTileMap(const TileCollisionMap* tileMap, ComponentStorage<ColliderComponent>* colliders);
+
+    // Sub-stepping - integrate and collide (contact solver, CCD, tile map) `count` times per frame at dt / count.
+    // Adaptive mode only substeps bodies at or above `speedThreshold`, the rest take one step.
+    void SetSubsteps(int count);
+    void SetAdaptiveSubsteps(bool enabled, float speedThreshold = 240.0f);
+
+    // Sleeping - bodies slower than `speed` for `frames` frames fall asleep.
+    // Bodies touching each other form an island which sleeps and wakes as a whole.
+    void SetSleepThreshold(float speed, int frames);
+    void SetSleepingEnabled(bool enabled);
+
 private:
     ComponentStorage<TransformComponent>& m_transforms;
     ComponentStorage<PhysicsComponent>& m_physics;
@@ -23,4 +63,51 @@ private:
 
     const float GetGravity() const;
     float m_gravity = 9.81;
+    VectorFloat m_wind{0.0f, 0.0f};
+    ForceFields* m_forceFields = nullptr;
+    std::vector<VectorFloat> m_points;  // field sample points, same order as the lanes
+
+    // Dynamic bodies, rebuilt only when components are added / removed
+    BodySets m_sets;
+
+    // Awake bodies this frame, in the same order as the integrator lanes
+    std::vector<DynamicBody> m_active;
+    std::vector<char> m_onTiles;
+    BodyLanes m_lanes;
+    void FillLanes(size_t substepCount, float deltaTime);
+    bool Advance(size_t index, float deltaTime);
+
+    // Sub-stepping
+    int m_substeps = 1;
+    bool m_adaptiveSubsteps = false;
+    float m_substepSpeed = 240.0f;  // px/s
+    std::vector<EntityID> m_substepIds;  // sorted, mixed frames only
+    std::vector<std::pair<EntityID, EntityID>> m_substepPairs;
+    bool NeedsSubsteps(const PhysicsComponent& phys) const;
+    void GatherSubstepPairs(size_t substepCount);
+
+    // CCD
+    CollisionSystem* m_collisionSystem = nullptr;
+    float m_continuousThreshold = 120.0f;  // px/s, slower bodies never take the swept path
+    void ClampToImpact(EntityID id, PhysicsComponent& phys, VectorFloat& delta);
+
+    // Contacts
+    ConstraintSolver* m_solver = nullptr;
+    std::vector<char> m_grounded;  // solver ground flag per lane
+    void SolveContacts(float deltaTime, bool substepPairsOnly);
+
+    // Tile map
+    const TileCollisionMap* m_tileMap = nullptr;
+    ComponentStorage<ColliderComponent>* m_colliders = nullptr;
+    bool MoveOnTileMap(EntityID id, const TransformComponent& transform, PhysicsComponent& phys, VectorFloat& delta);
+
+    // Sleeping
+    bool m_sleepingEnabled = true;
+    float m_sleepSpeed = 5.0f;  // px/s
+    int m_sleepFrames = 60;
+    std::vector<DynamicBody> m_bodies;  // non-static bodies this frame
+    std::unordered_map<EntityID, size_t> m_bodyIndex;
+    UnionFind m_islands;
+    void UpdateSleep();
+    bool IsDisturbed(const DynamicBody& body) const;
 };
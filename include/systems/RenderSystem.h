@@ -7,7 +7,28 @@
 #include "graphics/Renderer.h"
 #include "core/IRenderer.h"
 #include "graphics/BackgroundLayer.h"
+#include "graphics/RenderQueue.h"
+#include "utils/EntityTypes.h"
+#include "utils/SpatialGrid.h"
+#include "utils/SweptAABB.h"
 
+#include <vector>
+
+class ParticleSystem;
+class TilemapRenderer;
+
+struct RenderStats {
+    size_t sprites = 0;   // sprites in the index
+    size_t visible = 0;   // drawn last Update
+    size_t moved = 0;     // re-inserted into the grid last Update
+};
+
+/*
+    Draws the sprites inside the camera rectangle (position, zoom, viewport).
+    Sprite bounds are kept in a grid; a sprite is only re-inserted when its bounds change,
+    and the whole index is rebuilt only when sprites or transforms are added / removed.
+    The camera rectangle queries just the cells it covers. Without a viewport size nothing is culled.
+*/
 class RenderSystem : public ISystem {
 public:
     RenderSystem(ComponentStorage<TransformComponent>& transforms,
@@ -30,6 +51,21 @@ public:
     void SetFadeAlpha(Uint8 alpha);
     void SetViewportSize(SDL_Point size);
 
+    // Target for the next Update, e.g. a RenderCommandList recorded for the render thread
+    void SetRenderer(IRenderer* renderer);
+
+    // Drawn on top of the sprites with the same camera
+    void SetParticleSystem(ParticleSystem* particles);
+
+    // Baked tile chunks, drawn between the background and the sprites
+    void SetTilemap(TilemapRenderer* tilemap);
+
+    // Entities drawn by the last Update, sorted by id - for animation, audio or AI level of detail
+    const std::vector<EntityID>& GetVisibleEntities() const;
+    bool IsVisible(EntityID entity) const;
+    const RenderStats& GetStats() const;
+    const RenderQueueStats& GetQueueStats() const;
+
 private:
     ComponentStorage<TransformComponent>& m_transforms;
     ComponentStorage<SpriteComponent>& m_sprites;
@@ -38,10 +74,38 @@ private:
     float m_cameraZoom = 1.0f;
     float m_rotationDegrees = 0.0f;
     Uint8 m_fadeAlpha;
-    SDL_Point m_viewport;
+    SDL_Point m_viewport = {0, 0};
     IRenderer* m_renderer;
+    ParticleSystem* m_particles = nullptr;
+    TilemapRenderer* m_tilemap = nullptr;
+    RenderQueue m_queue;  // visible sprites, batched per layer and texture
     
     // Background
     std::vector<BackgroundLayer> m_backgroundLayers;
     void DrawBackgroundLayers();
+
+    // Culling
+    struct SpriteProxy {
+        EntityID id;
+        const TransformComponent* transform;  // node pointers stay valid until the storage erases them
+        const SpriteComponent* sprite;
+        AABB bounds;
+        uint64_t stamp;                       // last query that reported it, dedupes multi-cell sprites
+    };
+
+    std::vector<SpriteProxy> m_proxies;
+    SpatialGrid<size_t> m_grid;                // cell -> index into m_proxies
+    std::vector<size_t> m_visibleProxies;
+    std::vector<EntityID> m_visible;
+    uint64_t m_spriteVersion = ~0ull;
+    uint64_t m_transformVersion = ~0ull;
+    uint64_t m_queryStamp = 0;
+    RenderStats m_stats;
+
+    void RebuildIndex();
+    void RefreshBounds();
+    void CollectVisible();
+    void InsertProxy(size_t index);
+    void RemoveProxy(size_t index);
+    void QueueSprite(const TransformComponent& transform, const SpriteComponent& sprite);
 };
\ No newline at end of file
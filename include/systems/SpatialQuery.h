@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "systems/CollisionSystem.h"
+#include "utils/CollisionLayer.h"
+#include "utils/SweptAABB.h"
+#include "utils/AABBKernel.h"
+#include "utils/Vector.h"
+
+struct RaycastHit {
+    EntityID entity = INVALID_ENTITY;
+    float distance = 0.0f;  // along the normalized direction
+    VectorFloat point;
+    VectorFloat normal;
+};
+
+/*
+    Read-only queries over the CollisionSystem broadphase.
+    All methods are const and only read the last Update snapshot,
+    so many callers (e.g. AI agents) can query in parallel.
+    Don't query while CollisionSystem::Update is running.
+*/
+class SpatialQuery {
+public:
+    explicit SpatialQuery(const CollisionSystem& collisionSystem);
+
+    // Closest hit along the ray (grid DDA traversal)
+    bool Raycast(const VectorFloat& origin, const VectorFloat& direction, float maxDistance,
+                 RaycastHit& hit, CollisionLayer mask = CollisionLayer::All,
+                 EntityID ignore = INVALID_ENTITY) const;
+
+    // All hits along the ray, sorted by distance
+    std::vector<RaycastHit> RaycastAll(const VectorFloat& origin, const VectorFloat& direction,
+                                       float maxDistance, CollisionLayer mask = CollisionLayer::All,
+                                       EntityID ignore = INVALID_ENTITY) const;
+
+    // Entities whose box contains the point
+    std::vector<EntityID> OverlapPoint(const VectorFloat& point, CollisionLayer mask = CollisionLayer::All) const;
+
+    // Entities overlapping the box / circle
+    std::vector<EntityID> OverlapBox(const AABB& box, CollisionLayer mask = CollisionLayer::All) const;
+    std::vector<EntityID> OverlapCircle(const VectorFloat& center, float radius,
+                                        CollisionLayer mask = CollisionLayer::All) const;
+
+    // Up to k entities closest to the point (distance to their box), nearest first
+    std::vector<EntityID> NearestK(const VectorFloat& point, size_t k, float maxDistance,
+                                   CollisionLayer mask = CollisionLayer::All,
+                                   EntityID ignore = INVALID_ENTITY) const;
+
+    // Earliest box hit while moving `box` by `delta` (boxes it already overlaps are ignored)
+    bool SweepBox(const AABB& box, const VectorFloat& delta, SweepHit& hit,
+                  CollisionLayer mask = CollisionLayer::All, EntityID ignore = INVALID_ENTITY) const;
+
+private:
+    const CollisionSystem& m_collisionSystem;
+
+    // Walk grid cells along the ray; visitor returns false to stop
+    template<typename Visitor>
+    void TraverseRay(const VectorFloat& origin, const VectorFloat& dir, float maxDistance,
+                     Visitor&& visit) const;
+};
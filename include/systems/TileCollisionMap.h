@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "utils/SweptAABB.h"
+#include "utils/Vector.h"
+
+struct LevelData;
+
+// One byte per tile
+enum class TileShape : uint8_t {
+    Empty = 0,
+    Solid,
+    OneWay,     // solid only when landing on it from above
+    SlopeUp,    // '/' floor rising to the right
+    SlopeDown   // '\' floor falling to the right
+};
+
+// Sides blocked during the last Move
+struct TileContact {
+    bool left = false;
+    bool right = false;
+    bool ceiling = false;
+    bool ground = false;
+};
+
+/*
+    Static level geometry as a compact tile grid instead of one collider entity per tile.
+    Boxes are moved with per-axis tile sweeps (X first, then Y), so they stop at the first
+    blocking tile even when the frame displacement is many tiles long.
+
+    JSON format:
+    {
+        "tileSize": 32,
+        "origin": [0, 592],
+        "rows": [ "....==....", "...../####", "##########" ]
+    }
+    '.' empty, '#' solid, '=' one-way, '/' slope up, '\' slope down
+*/
+class TileCollisionMap {
+public:
+    bool LoadFromFile(const std::string& path);
+    bool LoadFromJson(const nlohmann::json& j);
+    bool LoadLevel(const LevelData& level);  // LevelData::tilemapPath
+
+    void Resize(int width, int height, int tileSize, VectorFloat origin = {0.0f, 0.0f});
+    void SetTile(int x, int y, TileShape shape);
+    TileShape GetTile(int x, int y) const;  // Empty outside the map
+
+    bool IsLoaded() const;
+    int GetWidth() const;
+    int GetHeight() const;
+    int GetTileSize() const;
+
+    // Displacement the box can actually make this frame (X first, then Y)
+    VectorFloat Move(const AABB& box, const VectorFloat& delta, TileContact& contact) const;
+
+private:
+    int m_width = 0;
+    int m_height = 0;
+    int m_tileSize = 32;
+    VectorFloat m_origin{0.0f, 0.0f};
+    std::vector<uint8_t> m_tiles;
+
+    int ToTileX(float x) const;
+    int ToTileY(float y) const;
+    bool IsSlope(TileShape shape) const;
+    float SlopeSurface(int tx, int ty, float x) const;  // floor height at world x
+
+    float MoveX(const AABB& box, float dx, TileContact& contact) const;
+    float MoveY(const AABB& box, float dy, TileContact& contact) const;
+    bool IsOnGround(const AABB& box) const;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "core/ISystem.h"
+#include "core/ComponentStorage.h"
+#include "components/ColliderComponent.h"
+#include "components/TransformComponent.h"
+#include "event/custom_events/TriggerEvent.h"
+#include "systems/CollisionSystem.h"
+#include "utils/SpatialGrid.h"
+
+/*
+    Trigger / sensor volumes on their own path (the CollisionSystem skips them).
+    Triggers live in a separate grid that is rebuilt only when colliders or transforms are
+    added / removed (storage versions) or InvalidateTriggers() is called, so static triggers
+    cost nothing per frame. Only non-trigger colliders that moved since the last Update
+    query it, and the result is a list of enter / exit events - no physics response.
+*/
+class TriggerSystem : public ISystem {
+public:
+    TriggerSystem(ComponentStorage<TransformComponent>& transforms,
+                  ComponentStorage<ColliderComponent>& colliders);
+
+    void Update(float deltaTime) override;  // ISystem method
+
+    // Enter / exit events of the last Update
+    const std::vector<TriggerEvent>& GetEvents() const;
+
+    // Forces a rebuild - call after moving or resizing a trigger, or changing a layer or mask
+    void InvalidateTriggers();
+
+    bool IsInside(EntityID other, EntityID trigger) const;
+
+private:
+    struct Mover {
+        EntityID id;
+        AABB bounds;
+        const TransformComponent* transform;
+        const ColliderComponent* collider;
+    };
+
+    ComponentStorage<TransformComponent>& m_transforms;
+    ComponentStorage<ColliderComponent>& m_colliders;
+
+    SpatialGrid<size_t> m_grid;          // cell -> indices into m_triggers
+    std::vector<ColliderProxy> m_triggers;
+    std::vector<Mover> m_movers;
+    std::unordered_map<EntityID, std::vector<EntityID>> m_inside;  // mover -> triggers (sorted)
+
+    uint64_t m_colliderVersion = ~0ull;
+    uint64_t m_transformVersion = ~0ull;
+    bool m_dirty = true;
+
+    std::vector<TriggerEvent> m_events;
+    std::vector<EntityID> m_overlaps;  // scratch
+
+    void Rebuild();
+    void QueryMover(const Mover& mover, const ColliderComponent& collider);
+    void Diff(EntityID mover, std::vector<EntityID>& inside, const std::vector<EntityID>& now);
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/SweptAABB.h"
+#include "utils/Simd.h"
+
+/*
+    Batched AABB overlap: one box against up to AABB_BATCH candidates stored as SoA min/max arrays.
+    Bit i of the result is set if candidate i overlaps the box (touching edges don't count).
+    The SIMD path is chosen at build time: AVX2 (8 lanes), SSE2 (2 x 4 lanes) or scalar.
+*/
+constexpr size_t AABB_BATCH = 8;
+
+// One batch of candidates, 32-byte aligned for the AVX2 loads.
+// Zero-filled, so the SIMD loads never read uninitialised lanes past `count` in a partial batch.
+struct AABBLanes {
+    alignas(32) float minX[AABB_BATCH] = {};
+    alignas(32) float minY[AABB_BATCH] = {};
+    alignas(32) float maxX[AABB_BATCH] = {};
+    alignas(32) float maxY[AABB_BATCH] = {};
+    size_t count = 0;
+
+    void Push(const AABB& box) {
+        minX[count] = box.x;
+        minY[count] = box.y;
+        maxX[count] = box.x + box.w;
+        maxY[count] = box.y + box.h;
+        ++count;
+    }
+
+    bool Full() const { return count == AABB_BATCH; }
+};
+
+// Reference path, also used to check the SIMD ones
+inline uint32_t OverlapMaskScalar(const AABB& box, const float* minX, const float* minY,
+                                  const float* maxX, const float* maxY) {
+    const float bMinX = box.x, bMinY = box.y;
+    const float bMaxX = box.x + box.w, bMaxY = box.y + box.h;
+
+    uint32_t mask = 0;
+    for (size_t i = 0; i < AABB_BATCH; ++i) {
+        const bool hit = bMinX < maxX[i] && bMaxX > minX[i] &&
+                         bMinY < maxY[i] && bMaxY > minY[i];
+        mask |= static_cast<uint32_t>(hit) << i;
+    }
+    return mask;
+}
+
+// Arrays hold AABB_BATCH floats each (32-byte aligned for AVX2, 16 for SSE2)
+inline uint32_t OverlapMask(const AABB& box, const float* minX, const float* minY,
+                            const float* maxX, const float* maxY) {
+#if defined(ENGINE_SIMD_AVX2)
+    const __m256 bMinX = _mm256_set1_ps(box.x);
+    const __m256 bMinY = _mm256_set1_ps(box.y);
+    const __m256 bMaxX = _mm256_set1_ps(box.x + box.w);
+    const __m256 bMaxY = _mm256_set1_ps(box.y + box.h);
+
+    const __m256 x = _mm256_and_ps(_mm256_cmp_ps(bMinX, _mm256_load_ps(maxX), _CMP_LT_OQ),
+                                   _mm256_cmp_ps(bMaxX, _mm256_load_ps(minX), _CMP_GT_OQ));
+    const __m256 y = _mm256_and_ps(_mm256_cmp_ps(bMinY, _mm256_load_ps(maxY), _CMP_LT_OQ),
+                                   _mm256_cmp_ps(bMaxY, _mm256_load_ps(minY), _CMP_GT_OQ));
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(x, y)));
+#elif defined(ENGINE_SIMD_SSE2)
+    const __m128 bMinX = _mm_set1_ps(box.x);
+    const __m128 bMinY = _mm_set1_ps(box.y);
+    const __m128 bMaxX = _mm_set1_ps(box.x + box.w);
+    const __m128 bMaxY = _mm_set1_ps(box.y + box.h);
+
+    uint32_t mask = 0;
+    for (size_t i = 0; i < AABB_BATCH; i += 4) {
+        const __m128 x = _mm_and_ps(_mm_cmplt_ps(bMinX, _mm_load_ps(maxX + i)),
+                                    _mm_cmpgt_ps(bMaxX, _mm_load_ps(minX + i)));
+        const __m128 y = _mm_and_ps(_mm_cmplt_ps(bMinY, _mm_load_ps(maxY + i)),
+                                    _mm_cmpgt_ps(bMaxY, _mm_load_ps(minY + i)));
+        mask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(x, y))) << i;
+    }
+    return mask;
+#else
+    return OverlapMaskScalar(box, minX, minY, maxX, maxY);
+#endif
+}
+
+// Lanes past `count` are never reported
+inline uint32_t OverlapMask(const AABB& box, const AABBLanes& lanes) {
+    const uint32_t used = (1u << lanes.count) - 1u;
+    return OverlapMask(box, lanes.minX, lanes.minY, lanes.maxX, lanes.maxY) & used;
+}
@@ -20,6 +20,7 @@ struct AnimationTransform {
 struct Frame {
     Texture* texture; 
     float duration;  // Frame duration
+    SDL_Rect srcRect{0, 0, 0, 0};  // atlas region, w == 0: whole texture
 };
 
 struct FrameAnimationClip {
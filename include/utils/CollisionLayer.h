@@ -1,7 +1,8 @@
 #pragma once
 #include <cstdint>
 
-enum class CollisionLayer : uint8_t {
+// 32 layer bits, the first 8 are named - the rest are free for game-specific layers
+enum class CollisionLayer : uint32_t {
     None         = 0,          // 00000000
     Player       = 1,          // 00000001
     Enemy        = 1 << 1,     // 00000010
@@ -11,5 +12,14 @@ enum class CollisionLayer : uint8_t {
     Trigger      = 1 << 5,     // 00100000 — trigger box
     Sensor       = 1 << 6,     // 01000000 — example, invlisible sensor
     Environment  = 1 << 7,     // 10000000 — water, lava, traps etc.
-    All          = 0xFF        // 11111111 — all
+    All          = 0xFFFFFFFF  // all 32 bits
 };
+
+// True if the two layer sets share at least one bit
+inline bool HasAnyLayer(CollisionLayer a, CollisionLayer b) {
+    return (static_cast<uint32_t>(a) & static_cast<uint32_t>(b)) != 0;
+}
+
+inline CollisionLayer operator|(CollisionLayer a, CollisionLayer b) {
+    return static_cast<CollisionLayer>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+}
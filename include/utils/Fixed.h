@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/*
+    Q16.16 fixed-point number for deterministic simulation (ENGINE_FIXED_POINT builds).
+    All arithmetic is integer, so results are bit-identical across compilers, optimisation
+    levels and CPUs. Range is about +-32767 with a resolution of 1/65536; results saturate
+    instead of wrapping. Conversions from / to float are exact up to rounding.
+*/
+class Fixed {
+public:
+    static constexpr int FRACTION_BITS = 16;
+    static constexpr int64_t ONE = int64_t{1} << FRACTION_BITS;
+
+    constexpr Fixed() = default;
+    explicit Fixed(float value) : m_raw{Saturate(static_cast<int64_t>(std::llround(static_cast<double>(value) * ONE)))} {}
+    explicit constexpr Fixed(int value) : m_raw{Saturate(int64_t{value} * ONE)} {}
+
+    static constexpr Fixed FromRaw(int32_t raw) {
+        Fixed f;
+        f.m_raw = raw;
+        return f;
+    }
+
+    constexpr int32_t Raw() const { return m_raw; }
+    explicit operator float() const { return static_cast<float>(static_cast<double>(m_raw) / ONE); }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) { return FromRaw(Saturate(int64_t{a.m_raw} + b.m_raw)); }
+    friend constexpr Fixed operator-(Fixed a, Fixed b) { return FromRaw(Saturate(int64_t{a.m_raw} - b.m_raw)); }
+    friend constexpr Fixed operator-(Fixed a) { return FromRaw(Saturate(-int64_t{a.m_raw})); }
+
+    // Rounded to nearest, ties away from zero
+    friend constexpr Fixed operator*(Fixed a, Fixed b) {
+        return FromRaw(Saturate(RoundShift(int64_t{a.m_raw} * b.m_raw)));
+    }
+
+    // Truncated towards zero, x / 0 saturates
+    friend constexpr Fixed operator/(Fixed a, Fixed b) {
+        if (b.m_raw == 0) return FromRaw(a.m_raw >= 0 ? MAX_RAW : MIN_RAW);
+        return FromRaw(Saturate(int64_t{a.m_raw} * ONE / b.m_raw));
+    }
+
+    Fixed& operator+=(Fixed b) { return *this = *this + b; }
+    Fixed& operator-=(Fixed b) { return *this = *this - b; }
+    Fixed& operator*=(Fixed b) { return *this = *this * b; }
+    Fixed& operator/=(Fixed b) { return *this = *this / b; }
+
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.m_raw == b.m_raw; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.m_raw != b.m_raw; }
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a.m_raw < b.m_raw; }
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a.m_raw > b.m_raw; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.m_raw <= b.m_raw; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.m_raw >= b.m_raw; }
+
+    // Integer square root of a non-negative 64-bit value (bit by bit, no floating point)
+    static constexpr uint64_t ISqrt(uint64_t value) {
+        uint64_t result = 0;
+        uint64_t bit = uint64_t{1} << 62;
+        while (bit > value) bit >>= 2;
+        while (bit != 0) {
+            if (value >= result + bit) {
+                value -= result + bit;
+                result = (result >> 1) + bit;
+            } else {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        return result;
+    }
+
+private:
+    static constexpr int32_t MAX_RAW = std::numeric_limits<int32_t>::max();
+    static constexpr int32_t MIN_RAW = std::numeric_limits<int32_t>::min();
+
+    int32_t m_raw = 0;
+
+    static constexpr int32_t Saturate(int64_t value) {
+        return value > MAX_RAW ? MAX_RAW : value < MIN_RAW ? MIN_RAW : static_cast<int32_t>(value);
+    }
+
+    // Q32.32 -> Q16.16 (divides instead of shifting so negative values round the same way)
+    static constexpr int64_t RoundShift(int64_t value) {
+        return value >= 0 ? (value + ONE / 2) / ONE : -((-value + ONE / 2) / ONE);
+    }
+};
+
+inline Fixed Sqrt(Fixed value) {
+    if (value.Raw() <= 0) return Fixed{};
+    return Fixed::FromRaw(static_cast<int32_t>(Fixed::ISqrt(static_cast<uint64_t>(value.Raw()) << Fixed::FRACTION_BITS)));
+}
+
+// |(x, y)| computed in 64 bits - x * x alone overflows Q16.16 above 181
+inline Fixed Length(Fixed x, Fixed y) {
+    const uint64_t squared = static_cast<uint64_t>(int64_t{x.Raw()} * x.Raw()) +
+                             static_cast<uint64_t>(int64_t{y.Raw()} * y.Raw());
+    const uint64_t length = Fixed::ISqrt(squared);
+    return Fixed::FromRaw(length > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())
+                              ? std::numeric_limits<int32_t>::max()
+                              : static_cast<int32_t>(length));
+}
+
+// Unit vector, (0, 0) stays (0, 0)
+inline void Normalize(Fixed& x, Fixed& y) {
+    const Fixed length = Length(x, y);
+    if (length == Fixed{}) return;
+    x = x / length;
+    y = y / length;
+}
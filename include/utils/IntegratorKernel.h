@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "utils/Real.h"
+#include "utils/Simd.h"
+
+/*
+    Velocity integration for a batch of bodies stored as SoA lanes.
+    PhysicsSystem gathers the awake bodies, runs IntegrateBodies and scatters the velocities back.
+
+    Per body, in the same order as the scalar path:
+    acceleration, gravity (not grounded), impulse, force, friction (grounded), damping, max-speed clamp.
+    Friction never reverses a velocity - it stops the body once it would remove the whole speed.
+    Branches become masks: static bodies (invMass == 0) and grounded bodies keep their lanes untouched.
+
+    Tolerance: every operation is an IEEE add / mul / div / sqrt in the scalar order, so both paths agree
+    bit for bit unless the compiler contracts the scalar code into FMAs; then they stay within 1e-5 relative.
+    ENGINE_FIXED_POINT builds always take the scalar path in Q16.16.
+*/
+struct BodyLanes {
+    // In / out
+    std::vector<float> vx, vy;
+    // In
+    std::vector<float> ax, ay;          // AccelerationComponent, 0 without one
+    std::vector<float> fx, fy;
+    std::vector<float> ix, iy;
+    std::vector<float> mass, invMass;
+    std::vector<float> gravityScale, friction, damping, maxSpeed;
+    std::vector<float> grounded;        // 1 or 0
+    // Out - speed before the clamp, capped at maxSpeed (used to pick the CCD path)
+    std::vector<float> speed;
+
+    size_t Size() const { return vx.size(); }
+
+    void Resize(size_t count) {
+        for (std::vector<float>* lane : { &vx, &vy, &ax, &ay, &fx, &fy, &ix, &iy, &mass, &invMass,
+                                          &gravityScale, &friction, &damping, &maxSpeed, &grounded, &speed }) {
+            lane->resize(count);
+        }
+    }
+};
+
+// Scalar path in any Real type (float, or Fixed for deterministic builds)
+template<typename T>
+inline void IntegrateBodiesRange(BodyLanes& b, size_t begin, size_t end, float deltaTime, float gravityValue) {
+    const T dt(deltaTime);
+    const T gravity(gravityValue);
+    const T zero(0.0f);
+
+    for (size_t i = begin; i < end; ++i) {
+        const bool dynamic = b.invMass[i] > 0.0f;
+        const T mass(b.mass[i]), invMass(b.invMass[i]);
+        T vx(b.vx[i]), vy(b.vy[i]);
+        T fy(b.fy[i]);
+
+        if (dynamic) {
+            vx += T(b.ax[i]) * dt;
+            vy += T(b.ay[i]) * dt;
+        }
+        if (b.grounded[i] == 0.0f && dynamic) {
+            fy += gravity * T(b.gravityScale[i]) * mass;
+        }
+        if (dynamic) {
+            vx += T(b.ix[i]) * invMass;
+            vy += T(b.iy[i]) * invMass;
+            vx += T(b.fx[i]) * invMass * dt;
+            vy += fy * invMass * dt;
+        }
+
+        if (b.grounded[i] != 0.0f) {
+            const T speed = Length(vx, vy);
+            const T frictionForce = T(b.friction[i]) * mass * gravity;
+
+            // Stops instead of reversing when friction would remove more than the speed
+            if (speed < T(0.01f) || speed <= frictionForce * invMass * dt) {
+                vx = zero;
+                vy = zero;
+            } else {
+                const T dirX = -vx / speed;
+                const T dirY = -vy / speed;
+                vx += dirX * frictionForce * invMass * dt;
+                vy += dirY * frictionForce * invMass * dt;
+            }
+        }
+
+        const T keep = T(1.0f) - T(b.damping[i]);
+        vx *= keep;
+        vy *= keep;
+
+        const T maxSpeed(b.maxSpeed[i]);
+        const T speed = Length(vx, vy);
+        if (speed > maxSpeed) {
+            const T scale = maxSpeed / speed;
+            vx *= scale;
+            vy *= scale;
+        }
+
+        b.vx[i] = ToFloat(vx);
+        b.vy[i] = ToFloat(vy);
+        b.speed[i] = ToFloat(std::min(speed, maxSpeed));
+    }
+}
+
+// Reference path, also handles the tail the SIMD loop leaves over
+inline void IntegrateBodiesScalar(BodyLanes& b, size_t begin, size_t end, float dt, float gravity) {
+    IntegrateBodiesRange<Real>(b, begin, end, dt, gravity);
+}
+
+// Lanes [begin, end)
+inline void IntegrateBodies(BodyLanes& b, size_t begin, size_t end, float dt, float gravity) {
+    size_t i = begin;
+
+#if (defined(ENGINE_SIMD_AVX2) || defined(ENGINE_SIMD_SSE2)) && !defined(ENGINE_FIXED_POINT)
+    using namespace simd;
+    const Float zero = Set(0.0f);
+    const Float one = Set(1.0f);
+    const Float stopSpeed = Set(0.01f);
+    const Float vdt = Set(dt);
+    const Float g = Set(gravity);
+
+    for (; i + SIMD_WIDTH <= end; i += SIMD_WIDTH) {
+        Float vx = Load(&b.vx[i]), vy = Load(&b.vy[i]);
+        const Float mass = Load(&b.mass[i]), invMass = Load(&b.invMass[i]);
+        const Float dynamic = Greater(invMass, zero);
+        const Float grounded = Greater(Load(&b.grounded[i]), zero);
+
+        // Acceleration, gravity, impulse, force
+        vx = Add(vx, And(dynamic, Mul(Load(&b.ax[i]), vdt)));
+        vy = Add(vy, And(dynamic, Mul(Load(&b.ay[i]), vdt)));
+
+        const Float weight = Mul(Mul(g, Load(&b.gravityScale[i])), mass);
+        const Float fy = Add(Load(&b.fy[i]), And(AndNot(grounded, dynamic), weight));
+
+        vx = Add(vx, And(dynamic, Mul(Load(&b.ix[i]), invMass)));
+        vy = Add(vy, And(dynamic, Mul(Load(&b.iy[i]), invMass)));
+        vx = Add(vx, And(dynamic, Mul(Mul(Load(&b.fx[i]), invMass), vdt)));
+        vy = Add(vy, And(dynamic, Mul(Mul(fy, invMass), vdt)));
+
+        // Friction - grounded lanes stop below 0.01 / the friction step, or slow down along -v
+        Float speed = Sqrt(Add(Mul(vx, vx), Mul(vy, vy)));
+        const Float frictionForce = Mul(Mul(Load(&b.friction[i]), mass), g);
+        const Float frictionStep = Mul(Mul(frictionForce, invMass), vdt);
+        const Float stop = And(grounded, Or(Less(speed, stopSpeed), LessEqual(speed, frictionStep)));
+        const Float sliding = AndNot(stop, grounded);
+
+        const Float safeSpeed = Select(sliding, speed, one);  // no 0 / 0 in the masked-off lanes
+        const Float dirX = Div(Sub(zero, vx), safeSpeed);
+        const Float dirY = Div(Sub(zero, vy), safeSpeed);
+        vx = Select(sliding, Add(vx, Mul(Mul(Mul(dirX, frictionForce), invMass), vdt)), vx);
+        vy = Select(sliding, Add(vy, Mul(Mul(Mul(dirY, frictionForce), invMass), vdt)), vy);
+        vx = AndNot(stop, vx);
+        vy = AndNot(stop, vy);
+
+        // Damping
+        const Float keep = Sub(one, Load(&b.damping[i]));
+        vx = Mul(vx, keep);
+        vy = Mul(vy, keep);
+
+        // Max speed
+        const Float maxSpeed = Load(&b.maxSpeed[i]);
+        speed = Sqrt(Add(Mul(vx, vx), Mul(vy, vy)));
+        const Float over = Greater(speed, maxSpeed);
+        const Float scale = Div(maxSpeed, Select(over, speed, one));
+        vx = Select(over, Mul(vx, scale), vx);
+        vy = Select(over, Mul(vy, scale), vy);
+
+        Store(&b.vx[i], vx);
+        Store(&b.vy[i], vy);
+        Store(&b.speed[i], Min(speed, maxSpeed));
+    }
+#endif
+
+    IntegrateBodiesScalar(b, i, end, dt, gravity);
+}
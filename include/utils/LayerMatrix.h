@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "utils/CollisionLayer.h"
+
+/*
+    Layer-pair interaction matrix for the broadphase.
+    Colliders are bucketed by their lowest layer bit (bucket 32 = CollisionLayer::None).
+    Each bucket remembers the union of its layers and masks, so two buckets
+    can only produce a pair if one of them wants the other:
+        (masks[a] & layers[b]) || (masks[b] & layers[a])
+    The per-pair CanCollide test is still needed, the matrix only skips
+    bucket pairs that can never pass it (e.g. Pickup vs Wall).
+*/
+class LayerMatrix {
+public:
+    static constexpr int BUCKETS = 33;
+
+    static int BucketOf(CollisionLayer layer) {
+        uint32_t bits = static_cast<uint32_t>(layer);
+        if (bits == 0) return BUCKETS - 1;
+
+        int bucket = 0;
+        while ((bits & 1u) == 0) {
+            bits >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    void Clear() {
+        m_layers.fill(0);
+        m_masks.fill(0);
+        m_rows.fill(0);
+    }
+
+    // Accumulate one collider
+    void Add(CollisionLayer layer, CollisionLayer mask) {
+        const int bucket = BucketOf(layer);
+        m_layers[bucket] |= static_cast<uint32_t>(layer);
+        m_masks[bucket]  |= static_cast<uint32_t>(mask);
+    }
+
+    // Precompute rows once all colliders were added
+    void Build() {
+        for (int a = 0; a < BUCKETS; ++a) {
+            uint64_t row = 0;
+            for (int b = 0; b < BUCKETS; ++b) {
+                if ((m_masks[a] & m_layers[b]) || (m_masks[b] & m_layers[a])) {
+                    row |= uint64_t{1} << b;
+                }
+            }
+            m_rows[a] = row;
+        }
+    }
+
+    bool Interacts(int a, int b) const {
+        return (m_rows[a] >> b) & 1u;
+    }
+
+private:
+    std::array<uint32_t, BUCKETS> m_layers{};
+    std::array<uint32_t, BUCKETS> m_masks{};
+    std::array<uint64_t, BUCKETS> m_rows{};
+};
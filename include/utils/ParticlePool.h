@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "utils/Simd.h"
+
+// Per-emitter constants for one UpdateParticles call
+struct ParticleMotion {
+    float gravityX = 0.0f, gravityY = 0.0f;
+    float damping = 1.0f;                   // velocity multiplier per step
+    float startSize = 8.0f, endSize = 0.0f;
+    float startAlpha = 1.0f, endAlpha = 0.0f;
+};
+
+/*
+    Fixed-capacity particle storage as SoA lanes, one pool per emitter.
+    Live particles are packed in [0, count); dead ones are swap-removed so the update
+    never branches on liveness. Lanes are padded to a multiple of SIMD_WIDTH, the padding
+    is updated along with the live particles and never read back.
+*/
+struct ParticlePool {
+    std::vector<float> x, y;
+    std::vector<float> vx, vy;
+    std::vector<float> life;          // seconds left
+    std::vector<float> invLifetime;   // 1 / total lifetime
+    std::vector<float> size;          // px, follows startSize -> endSize
+    std::vector<float> alpha;         // 0..1, follows startAlpha -> endAlpha
+    std::vector<uint32_t> color;      // 0xRRGGBB tint picked at spawn
+    size_t count = 0;
+    size_t capacity = 0;
+
+    void Reserve(size_t maxParticles) {
+        const size_t lanes = (maxParticles + simd::SIMD_WIDTH - 1) / simd::SIMD_WIDTH * simd::SIMD_WIDTH;
+        for (std::vector<float>* lane : { &x, &y, &vx, &vy, &life, &invLifetime, &size, &alpha }) {
+            lane->assign(lanes, 0.0f);
+        }
+        color.assign(lanes, 0xFFFFFFu);
+        capacity = maxParticles;
+        count = 0;
+    }
+
+    bool Full() const { return count == capacity; }
+
+    // Last live particle moves into slot i
+    void SwapRemove(size_t i) {
+        const size_t last = --count;
+        x[i] = x[last];
+        y[i] = y[last];
+        vx[i] = vx[last];
+        vy[i] = vy[last];
+        life[i] = life[last];
+        invLifetime[i] = invLifetime[last];
+        size[i] = size[last];
+        alpha[i] = alpha[last];
+        color[i] = color[last];
+    }
+};
+
+// Scalar reference, also the tail after the SIMD blocks
+inline void UpdateParticlesRange(ParticlePool& p, const ParticleMotion& m, size_t begin, size_t end, float dt) {
+    for (size_t i = begin; i < end; ++i) {
+        p.vx[i] = (p.vx[i] + m.gravityX * dt) * m.damping;
+        p.vy[i] = (p.vy[i] + m.gravityY * dt) * m.damping;
+        p.x[i] += p.vx[i] * dt;
+        p.y[i] += p.vy[i] * dt;
+        p.life[i] -= dt;
+
+        const float t = p.life[i] * p.invLifetime[i];  // 1 at spawn, 0 at death
+        p.size[i] = m.endSize + (m.startSize - m.endSize) * t;
+        p.alpha[i] = m.endAlpha + (m.startAlpha - m.endAlpha) * t;
+    }
+}
+
+// Integrates the live particles, then swap-removes the ones whose life ran out
+inline void UpdateParticles(ParticlePool& p, const ParticleMotion& m, float dt) {
+    size_t i = 0;
+
+#if defined(ENGINE_SIMD_AVX2) || defined(ENGINE_SIMD_SSE2)
+    using namespace simd;
+    const Float step = Set(dt);
+    const Float gx = Set(m.gravityX * dt), gy = Set(m.gravityY * dt);
+    const Float damping = Set(m.damping);
+    const Float endSize = Set(m.endSize), sizeRange = Set(m.startSize - m.endSize);
+    const Float endAlpha = Set(m.endAlpha), alphaRange = Set(m.startAlpha - m.endAlpha);
+
+    // Padded lanes: the last block may run past count but never past the allocation
+    for (; i < p.count; i += SIMD_WIDTH) {
+        const Float vx = Mul(Add(Load(&p.vx[i]), gx), damping);
+        const Float vy = Mul(Add(Load(&p.vy[i]), gy), damping);
+        Store(&p.vx[i], vx);
+        Store(&p.vy[i], vy);
+        Store(&p.x[i], Add(Load(&p.x[i]), Mul(vx, step)));
+        Store(&p.y[i], Add(Load(&p.y[i]), Mul(vy, step)));
+
+        const Float life = Sub(Load(&p.life[i]), step);
+        Store(&p.life[i], life);
+
+        const Float t = Mul(life, Load(&p.invLifetime[i]));
+        Store(&p.size[i], Add(endSize, Mul(sizeRange, t)));
+        Store(&p.alpha[i], Add(endAlpha, Mul(alphaRange, t)));
+    }
+#endif
+    UpdateParticlesRange(p, m, i, p.count, dt);
+
+    for (size_t k = 0; k < p.count;) {
+        if (p.life[k] <= 0.0f) p.SwapRemove(k);
+        else ++k;
+    }
+}
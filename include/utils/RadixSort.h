@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct SortItem {
+    uint64_t key;
+    uint32_t index;
+};
+
+/*
+    Stable LSD radix sort on 64-bit keys, one byte per pass.
+    A pass whose byte is the same for every key is skipped, so keys that only use a few
+    bytes (or are already grouped) cost few passes. `scratch` is reused between calls.
+*/
+inline void RadixSortStable(std::vector<SortItem>& items, std::vector<SortItem>& scratch) {
+    const size_t n = items.size();
+    if (n < 2) return;
+    scratch.resize(n);
+
+    SortItem* src = items.data();
+    SortItem* dst = scratch.data();
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {};
+        for (size_t i = 0; i < n; ++i) ++counts[(src[i].key >> shift) & 0xFF];
+
+        // Every key has the same byte here - order is unchanged
+        if (counts[(src[0].key >> shift) & 0xFF] == n) continue;
+
+        size_t offset = 0;
+        for (size_t& c : counts) {
+            const size_t count = c;
+            c = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < n; ++i) dst[counts[(src[i].key >> shift) & 0xFF]++] = src[i];
+
+        SortItem* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != items.data()) items.swap(scratch);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cmath>
+
+#include "utils/Fixed.h"
+
+/*
+    Scalar type of the simulation math.
+    Default: float. ENGINE_FIXED_POINT (CMake option) switches it to Q16.16 Fixed so physics and
+    movement are bit-identical across compilers and optimisation levels (lockstep, replays).
+    Components keep storing float; values are converted on the way in and out.
+    Only the integrator and MovementSystem use Real. The contact solver, CCD, tile sweeps and
+    AABB tests stay float and rely on -ffp-contract=off alone, so they are reproducible for one
+    compiler and target but not guaranteed to match across compilers.
+*/
+#if defined(ENGINE_FIXED_POINT)
+using Real = Fixed;
+#else
+using Real = float;
+#endif
+
+inline float ToFloat(float value) { return value; }
+inline float ToFloat(Fixed value) { return static_cast<float>(value); }
+
+inline float Sqrt(float value) { return std::sqrt(value); }
+inline float Length(float x, float y) { return std::sqrt(x * x + y * y); }
+
+// Float in, float out - the arithmetic itself happens in Real
+inline float RealMul(float a, float b) { return ToFloat(Real(a) * Real(b)); }
+inline float RealAdd(float a, float b) { return ToFloat(Real(a) + Real(b)); }
+
+// a + b * c (two roundings, never contracted into an FMA)
+inline float RealMulAdd(float a, float b, float c) {
+    const Real product = Real(b) * Real(c);
+    return ToFloat(Real(a) + product);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+
+/*
+    Build-time SIMD selection shared by the engine kernels.
+    ENGINE_SIMD_AVX2 - built with -mavx2 (CMake option ENGINE_ENABLE_AVX2)
+    ENGINE_SIMD_SSE2 - x86-64 baseline
+    neither          - scalar fallback
+
+    simd::Float wraps one register of SIMD_WIDTH floats; comparisons return all-bits masks.
+*/
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define ENGINE_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ENGINE_SIMD_SSE2 1
+#endif
+
+namespace simd {
+
+#if defined(ENGINE_SIMD_AVX2)
+    constexpr size_t SIMD_WIDTH = 8;
+    using Float = __m256;
+
+    inline Float Load(const float* p)            { return _mm256_loadu_ps(p); }
+    inline void  Store(float* p, Float a)        { _mm256_storeu_ps(p, a); }
+    inline Float Set(float v)                    { return _mm256_set1_ps(v); }
+    inline Float Add(Float a, Float b)           { return _mm256_add_ps(a, b); }
+    inline Float Sub(Float a, Float b)           { return _mm256_sub_ps(a, b); }
+    inline Float Mul(Float a, Float b)           { return _mm256_mul_ps(a, b); }
+    inline Float Div(Float a, Float b)           { return _mm256_div_ps(a, b); }
+    inline Float Sqrt(Float a)                   { return _mm256_sqrt_ps(a); }
+    inline Float Min(Float a, Float b)           { return _mm256_min_ps(a, b); }
+    inline Float Less(Float a, Float b)          { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    inline Float LessEqual(Float a, Float b)     { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    inline Float Greater(Float a, Float b)       { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    inline Float And(Float a, Float b)           { return _mm256_and_ps(a, b); }
+    inline Float Or(Float a, Float b)            { return _mm256_or_ps(a, b); }
+    inline Float AndNot(Float mask, Float a)     { return _mm256_andnot_ps(mask, a); }  // ~mask & a
+    inline Float Select(Float mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+#elif defined(ENGINE_SIMD_SSE2)
+    constexpr size_t SIMD_WIDTH = 4;
+    using Float = __m128;
+
+    inline Float Load(const float* p)            { return _mm_loadu_ps(p); }
+    inline void  Store(float* p, Float a)        { _mm_storeu_ps(p, a); }
+    inline Float Set(float v)                    { return _mm_set1_ps(v); }
+    inline Float Add(Float a, Float b)           { return _mm_add_ps(a, b); }
+    inline Float Sub(Float a, Float b)           { return _mm_sub_ps(a, b); }
+    inline Float Mul(Float a, Float b)           { return _mm_mul_ps(a, b); }
+    inline Float Div(Float a, Float b)           { return _mm_div_ps(a, b); }
+    inline Float Sqrt(Float a)                   { return _mm_sqrt_ps(a); }
+    inline Float Min(Float a, Float b)           { return _mm_min_ps(a, b); }
+    inline Float Less(Float a, Float b)          { return _mm_cmplt_ps(a, b); }
+    inline Float LessEqual(Float a, Float b)     { return _mm_cmple_ps(a, b); }
+    inline Float Greater(Float a, Float b)       { return _mm_cmpgt_ps(a, b); }
+    inline Float And(Float a, Float b)           { return _mm_and_ps(a, b); }
+    inline Float Or(Float a, Float b)            { return _mm_or_ps(a, b); }
+    inline Float AndNot(Float mask, Float a)     { return _mm_andnot_ps(mask, a); }
+    inline Float Select(Float mask, Float a, Float b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+#else
+    constexpr size_t SIMD_WIDTH = 1;
+#endif
+
+}
@@ -7,7 +7,7 @@
 template <typename T>
 class SpatialGrid {
 public:
-    // INSERT, QUERY, CLEAR, GETALLCELLS
+    // INSERT, REMOVE, QUERY, CLEAR, GETALLCELLS
     void Clear() {
         m_cells.clear();
     }
@@ -16,6 +16,21 @@ public:
         m_cells[cell].push_back(item);
     }
 
+    // Swap-erase one occurrence; cells left empty are dropped
+    void Remove(const Int2& cell, const T& item) {
+        auto it = m_cells.find(cell);
+        if (it == m_cells.end()) return;
+
+        auto& items = it->second;
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (!(items[i] == item)) continue;
+            items[i] = items.back();
+            items.pop_back();
+            break;
+        }
+        if (items.empty()) m_cells.erase(it);
+    }
+
     const std::vector<T>& Query(int x, int y) const {
         static const std::vector<T> empty;
         Int2 cell = {x, y};
@@ -49,7 +64,7 @@ public:
         return m_cells;
     }
 
-    int GetCellSize() {
+    int GetCellSize() const {
         return cellSize_;
     }
 
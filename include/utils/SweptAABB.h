@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/Vector.h"
+#include "utils/EntityTypes.h"
+
+// Axis-aligned box: top-left corner + size (same convention as ColliderComponent)
+struct AABB {
+    float x, y, w, h;
+};
+
+// Result of a swept test
+struct SweepHit {
+    EntityID entity = INVALID_ENTITY;
+    float toi = 1.0f;       // time of impact in [0, 1) of the frame displacement
+    VectorFloat normal;     // surface normal of the hit box
+};
+
+// Swept AABB vs static AABB (slab test on the Minkowski sum).
+// Returns true if `moving` hits `target` while travelling by `delta` this frame.
+// Boxes that already overlap at t = 0 are left to the discrete test.
+inline bool SweepAABB(const AABB& moving, const VectorFloat& delta, const AABB& target,
+                      float& toi, VectorFloat& normal) {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+
+    // Distances to entry / exit on each axis
+    float entryX, exitX, entryY, exitY;
+    if (delta.x > 0.0f) {
+        entryX = target.x - (moving.x + moving.w);
+        exitX  = (target.x + target.w) - moving.x;
+    } else {
+        entryX = (target.x + target.w) - moving.x;
+        exitX  = target.x - (moving.x + moving.w);
+    }
+    if (delta.y > 0.0f) {
+        entryY = target.y - (moving.y + moving.h);
+        exitY  = (target.y + target.h) - moving.y;
+    } else {
+        entryY = (target.y + target.h) - moving.y;
+        exitY  = target.y - (moving.y + moving.h);
+    }
+
+    // Convert to times (no motion on an axis -> inside the slab forever or never)
+    float tEntryX, tExitX, tEntryY, tExitY;
+    if (delta.x == 0.0f) {
+        if (moving.x + moving.w <= target.x || moving.x >= target.x + target.w) return false;
+        tEntryX = -INF;
+        tExitX  = INF;
+    } else {
+        tEntryX = entryX / delta.x;
+        tExitX  = exitX / delta.x;
+    }
+    if (delta.y == 0.0f) {
+        if (moving.y + moving.h <= target.y || moving.y >= target.y + target.h) return false;
+        tEntryY = -INF;
+        tExitY  = INF;
+    } else {
+        tEntryY = entryY / delta.y;
+        tExitY  = exitY / delta.y;
+    }
+
+    const float tEntry = std::max(tEntryX, tEntryY);
+    const float tExit  = std::min(tExitX, tExitY);
+
+    // No hit: slabs don't intersect, hit is behind us, already overlapping or beyond this frame
+    if (tEntry > tExit || tEntry < 0.0f || tEntry >= 1.0f) return false;
+
+    toi = tEntry;
+    if (tEntryX > tEntryY) {
+        normal = { delta.x > 0.0f ? -1.0f : 1.0f, 0.0f };
+    } else {
+        normal = { 0.0f, delta.y > 0.0f ? -1.0f : 1.0f };
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+// Disjoint sets over dense indices [0, n) - path halving + union by size
+class UnionFind {
+public:
+    explicit UnionFind(size_t count = 0) { Reset(count); }
+
+    void Reset(size_t count) {
+        m_parent.resize(count);
+        m_size.assign(count, 1);
+        std::iota(m_parent.begin(), m_parent.end(), size_t{0});
+    }
+
+    size_t Find(size_t i) {
+        while (m_parent[i] != i) {
+            m_parent[i] = m_parent[m_parent[i]];
+            i = m_parent[i];
+        }
+        return i;
+    }
+
+    void Union(size_t a, size_t b) {
+        a = Find(a);
+        b = Find(b);
+        if (a == b) return;
+
+        if (m_size[a] < m_size[b]) std::swap(a, b);
+        m_parent[b] = a;
+        m_size[a] += m_size[b];
+    }
+
+    size_t Size() const { return m_parent.size(); }
+
+private:
+    std::vector<size_t> m_parent;
+    std::vector<uint32_t> m_size;
+};
@@ -41,6 +41,7 @@ public:
 
     // Events
     void PollEvents();
+    bool ConsumeRenderTargetsReset();  // true once after SDL_RENDER_TARGETS_RESET
 
 private:
     SDL_Window* m_window;
@@ -48,4 +49,5 @@ private:
     int m_height;
     bool m_isRunning;
     bool m_isFullscreen;
+    bool m_renderTargetsReset;
 };
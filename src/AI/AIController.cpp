@@ -1,4 +1,5 @@
 #include "AI/AIController.h"
+#include "systems/SpatialQuery.h"
 #include <algorithm>
 #include <cmath>
 
@@ -91,7 +92,21 @@ bool AIController::CanSeeEnemy() const {
     dot = std::clamp(dot, -1.0f, 1.0f);
     float angle = std::acos(dot) * 180.0f / M_PI;
 
-    return angle <= (m_fieldOfView * 0.5f);
+    if (angle > (m_fieldOfView * 0.5f)) return false;
+
+    return HasLineOfSight(targetPos);
+}
+
+// Walls between us and the point block the view
+bool AIController::HasLineOfSight(const VectorFloat& point) const {
+    if (!m_spatialQuery) return true;
+
+    const VectorFloat toPoint = point - m_position;
+    const float distance = toPoint.Length();
+    if (distance <= 0.0f) return true;
+
+    RaycastHit hit;
+    return !m_spatialQuery->Raycast(m_position, toPoint, distance, hit, CollisionLayer::Wall);
 }
 
 // Friendliness
@@ -200,6 +215,9 @@ int AIController::GetFaction() const { return m_factionID; }
 void AIController::SetAnimationComponent(AnimationComponent* anim) { m_animation = anim; }
 AnimationComponent* AIController::GetAnimationComponent() { return m_animation; }
 
+// Perception queries
+void AIController::SetSpatialQuery(const SpatialQuery* query) { m_spatialQuery = query; }
+
 // CD
 void AIController::SetAttackCooldown(float cd) { m_attackCooldown = cd; }
 float AIController::GetAttackCooldown() const { return m_attackCooldown; }
@@ -2,6 +2,9 @@
 
 // Setters and getters
 void AISystem::AddController(AIController* controller) {
+    if (controller && m_spatialQuery) {
+        controller->SetSpatialQuery(m_spatialQuery);
+    }
     m_controllers[NextControllerID_++] = controller;
 }
 
@@ -14,6 +17,13 @@ AIController* AISystem::GetController(ControllerID id) const {
     return it != m_controllers.end() ? it->second : nullptr;
 }
 
+void AISystem::SetSpatialQuery(const SpatialQuery* query) {
+    m_spatialQuery = query;
+    for (auto& [id, controller] : m_controllers) {
+        if (controller) controller->SetSpatialQuery(query);
+    }
+}
+
 // Update state
 void AISystem::Update(float deltaTime) {
     for (auto& [id, controller] : m_controllers) {
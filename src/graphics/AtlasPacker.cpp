@@ -0,0 +1,113 @@
+#include "graphics/AtlasPacker.h"
+
+#include <algorithm>
+
+AtlasPacker::AtlasPacker(int pageWidth, int pageHeight)
+    : m_pageWidth{std::max(1, pageWidth)}, m_pageHeight{std::max(1, pageHeight)} {}
+
+bool AtlasPacker::Insert(int width, int height, AtlasSlot& slot) {
+    if (width <= 0 || height <= 0 || width > m_pageWidth || height > m_pageHeight) return false;
+
+    // Earlier pages first so they fill up before later ones
+    for (size_t p = 0; p < m_pages.size(); ++p) {
+        if (InsertInPage(m_pages[p], width, height, slot.x, slot.y)) {
+            slot.page = static_cast<int>(p);
+            return true;
+        }
+    }
+
+    Page page;
+    page.skyline.push_back({ 0, 0, m_pageWidth });
+    m_pages.push_back(page);
+    slot.page = static_cast<int>(m_pages.size() - 1);
+    return InsertInPage(m_pages.back(), width, height, slot.x, slot.y);
+}
+
+bool AtlasPacker::InsertInPage(Page& page, int width, int height, int& x, int& y) const {
+    size_t best = page.skyline.size();
+    int bestBottom = 0, bestWidth = 0;
+
+    for (size_t i = 0; i < page.skyline.size(); ++i) {
+        const int top = FitAt(page, i, width, height);
+        if (top < 0) continue;
+
+        const int bottom = top + height;
+        const int segmentWidth = page.skyline[i].width;
+        if (best == page.skyline.size() || bottom < bestBottom ||
+            (bottom == bestBottom && segmentWidth < bestWidth)) {
+            best = i;
+            bestBottom = bottom;
+            bestWidth = segmentWidth;
+            x = page.skyline[i].x;
+            y = top;
+        }
+    }
+    if (best == page.skyline.size()) return false;
+
+    AddLevel(page, best, x, y, width, height);
+    page.usedHeight = std::max(page.usedHeight, y + height);
+    return true;
+}
+
+// Resting height of a rectangle whose left edge sits on segment `index`
+int AtlasPacker::FitAt(const Page& page, std::size_t index, int width, int height) const {
+    const int x = page.skyline[index].x;
+    if (x + width > m_pageWidth) return -1;
+
+    int y = 0;
+    int remaining = width;
+    for (size_t i = index; remaining > 0; ++i) {
+        if (i == page.skyline.size()) return -1;
+        y = std::max(y, page.skyline[i].y);
+        if (y + height > m_pageHeight) return -1;
+        remaining -= page.skyline[i].width;
+    }
+    return y;
+}
+
+// New segment on top of the rectangle; the ones it covers shrink or go away
+void AtlasPacker::AddLevel(Page& page, std::size_t index, int x, int y, int width, int height) const {
+    auto& sky = page.skyline;
+    sky.insert(sky.begin() + index, { x, y + height, width });
+
+    const int right = x + width;
+    for (size_t i = index + 1; i < sky.size();) {
+        if (sky[i].x >= right) break;
+
+        const int shrink = right - sky[i].x;
+        if (sky[i].width <= shrink) {
+            sky.erase(sky.begin() + i);
+            continue;
+        }
+        sky[i].x += shrink;
+        sky[i].width -= shrink;
+        break;
+    }
+
+    // Neighbours at the same height merge
+    for (size_t i = 0; i + 1 < sky.size();) {
+        if (sky[i].y == sky[i + 1].y) {
+            sky[i].width += sky[i + 1].width;
+            sky.erase(sky.begin() + i + 1);
+        } else {
+            ++i;
+        }
+    }
+}
+
+int AtlasPacker::GetPageCount() const {
+    return static_cast<int>(m_pages.size());
+}
+
+int AtlasPacker::GetUsedHeight(int page) const {
+    if (page < 0 || page >= static_cast<int>(m_pages.size())) return 0;
+    return m_pages[page].usedHeight;
+}
+
+int AtlasPacker::GetPageWidth() const {
+    return m_pageWidth;
+}
+
+int AtlasPacker::GetPageHeight() const {
+    return m_pageHeight;
+}
@@ -0,0 +1,73 @@
+#include "graphics/RenderCommandList.h"
+
+void RenderCommandList::DrawTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect* dstRect) {
+    if (!dstRect) return;
+
+    Command cmd{};
+    cmd.type = CommandType::Texture;
+    cmd.texture = texture;
+    cmd.hasSrc = srcRect != nullptr;
+    if (srcRect) cmd.src = *srcRect;
+    cmd.dst = *dstRect;
+    m_commands.push_back(cmd);
+}
+
+void RenderCommandList::DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                                     const int* indices, int numIndices) {
+    if (numVertices <= 0) return;
+
+    Command cmd{};
+    cmd.type = CommandType::Geometry;
+    cmd.texture = texture;
+    cmd.firstVertex = static_cast<uint32_t>(m_vertices.size());
+    cmd.vertexCount = static_cast<uint32_t>(numVertices);
+    cmd.firstIndex = static_cast<uint32_t>(m_indices.size());
+    cmd.indexCount = indices ? static_cast<uint32_t>(numIndices) : 0;
+
+    m_vertices.insert(m_vertices.end(), vertices, vertices + numVertices);
+    if (indices) m_indices.insert(m_indices.end(), indices, indices + numIndices);
+    m_commands.push_back(cmd);
+}
+
+void RenderCommandList::DrawLine(int x1, int y1, int x2, int y2, SDL_Color color) {
+    Command cmd{};
+    cmd.type = CommandType::Line;
+    cmd.dst = { x1, y1, x2, y2 };
+    cmd.color = color;
+    m_commands.push_back(cmd);
+}
+
+// Indices stay relative to their own batch, so each call gets its slice of both pools
+void RenderCommandList::Execute(IRenderer& renderer) const {
+    for (const Command& cmd : m_commands) {
+        switch (cmd.type) {
+            case CommandType::Texture:
+                renderer.DrawTexture(cmd.texture, cmd.hasSrc ? &cmd.src : nullptr, &cmd.dst);
+                break;
+
+            case CommandType::Geometry:
+                renderer.DrawGeometry(cmd.texture, m_vertices.data() + cmd.firstVertex, static_cast<int>(cmd.vertexCount),
+                                      cmd.indexCount ? m_indices.data() + cmd.firstIndex : nullptr,
+                                      static_cast<int>(cmd.indexCount));
+                break;
+
+            case CommandType::Line:
+                renderer.DrawLine(cmd.dst.x, cmd.dst.y, cmd.dst.w, cmd.dst.h, cmd.color);
+                break;
+        }
+    }
+}
+
+void RenderCommandList::Clear() {
+    m_commands.clear();
+    m_vertices.clear();
+    m_indices.clear();
+}
+
+size_t RenderCommandList::GetCommandCount() const {
+    return m_commands.size();
+}
+
+size_t RenderCommandList::GetVertexCount() const {
+    return m_vertices.size();
+}
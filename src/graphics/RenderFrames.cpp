@@ -0,0 +1,56 @@
+#include "graphics/RenderFrames.h"
+
+#include <utility>
+
+// Only the simulation touches the back list, no lock needed
+RenderCommandList& RenderFrames::BeginRecord() {
+    m_lists[m_back].Clear();
+    return m_lists[m_back];
+}
+
+void RenderFrames::Publish() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_changed.wait(lock, [this] { return m_stopped || (!m_frontReady && !m_reading); });
+    if (m_stopped) return;
+
+    std::swap(m_front, m_back);
+    m_frontReady = true;
+    m_changed.notify_all();
+}
+
+const RenderCommandList* RenderFrames::Acquire() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_changed.wait(lock, [this] { return m_stopped || m_frontReady; });
+    if (m_stopped) return nullptr;
+
+    m_frontReady = false;
+    m_reading = true;
+    return &m_lists[m_front];
+}
+
+const RenderCommandList* RenderFrames::TryAcquire() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopped || !m_frontReady) return nullptr;
+
+    m_frontReady = false;
+    m_reading = true;
+    return &m_lists[m_front];
+}
+
+// The simulation only ever swaps front and back, so the last list stays with the render side
+void RenderFrames::Release() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(m_last, m_front);
+    m_reading = false;
+    m_changed.notify_all();
+}
+
+const RenderCommandList& RenderFrames::GetLast() const {
+    return m_lists[m_last];
+}
+
+void RenderFrames::Stop() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopped = true;
+    m_changed.notify_all();
+}
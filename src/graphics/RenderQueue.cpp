@@ -0,0 +1,109 @@
+#include "graphics/RenderQueue.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr int LAYER_BITS = 16;
+    constexpr int Y_BITS = 24;
+    constexpr int TEXTURE_BITS = 24;
+
+    constexpr int64_t LAYER_BIAS = int64_t{1} << (LAYER_BITS - 1);
+    constexpr int64_t Y_BIAS = int64_t{1} << (Y_BITS - 1);
+    constexpr uint64_t TEXTURE_MASK = (uint64_t{1} << TEXTURE_BITS) - 1;
+}
+
+void RenderQueue::Push(SDL_Texture* texture, int layer, const SDL_FRect& dst, const SDL_FRect& uv,
+                       float sortY, SDL_Color color) {
+    m_keys.push_back(MakeKey(texture, layer, sortY));
+    m_quads.push_back({ texture, layer, dst, uv, color });
+}
+
+// layer | y | texture, each field biased so the unsigned key orders like the signed value
+uint64_t RenderQueue::MakeKey(SDL_Texture* texture, int layer, float sortY) {
+    auto [it, added] = m_textureIds.try_emplace(texture, static_cast<uint32_t>(m_textureIds.size()));
+
+    const int64_t l = std::clamp<int64_t>(int64_t{layer} + LAYER_BIAS, 0, (int64_t{1} << LAYER_BITS) - 1);
+    const int64_t y = std::clamp<int64_t>(static_cast<int64_t>(std::floor(sortY)) + Y_BIAS, 0,
+                                          (int64_t{1} << Y_BITS) - 1);
+
+    return (static_cast<uint64_t>(l) << (Y_BITS + TEXTURE_BITS)) |
+           (static_cast<uint64_t>(y) << TEXTURE_BITS) |
+           (it->second & TEXTURE_MASK);
+}
+
+void RenderQueue::Flush(IRenderer* renderer) {
+    m_stats.quads = m_quads.size();
+    m_stats.batches = 0;
+    if (!renderer || m_quads.empty()) {
+        Clear();
+        return;
+    }
+
+    Sort();
+
+    size_t begin = 0;
+    for (size_t i = 1; i <= m_order.size(); ++i) {
+        if (i < m_order.size()) {
+            const Quad& a = m_quads[m_order[begin].index];
+            const Quad& b = m_quads[m_order[i].index];
+            if (a.layer == b.layer && a.texture == b.texture) continue;
+        }
+        EmitRun(renderer, begin, i);
+        begin = i;
+    }
+    Clear();
+}
+
+// Static scenes submit the same keys every frame - keep last frame's order
+void RenderQueue::Sort() {
+    m_stats.sortSkipped = m_keys == m_lastKeys;
+    if (m_stats.sortSkipped) return;
+
+    m_order.resize(m_keys.size());
+    for (size_t i = 0; i < m_keys.size(); ++i) {
+        m_order[i] = { m_keys[i], static_cast<uint32_t>(i) };
+    }
+    RadixSortStable(m_order, m_scratch);
+    m_lastKeys.swap(m_keys);
+}
+
+// Sorted entries [begin, end) share layer and texture
+void RenderQueue::EmitRun(IRenderer* renderer, size_t begin, size_t end) {
+    const size_t count = end - begin;
+
+    for (size_t q = m_indices.size() / 6; q < count; ++q) {
+        const int base = static_cast<int>(q * 4);
+        m_indices.insert(m_indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+    }
+
+    m_vertices.resize(count * 4);
+    SDL_Vertex* v = m_vertices.data();
+    for (size_t i = begin; i < end; ++i, v += 4) {
+        const Quad& quad = m_quads[m_order[i].index];
+        const SDL_FRect& r = quad.dst;
+        const SDL_FRect& t = quad.uv;
+        const SDL_Color c = quad.color;
+        v[0] = { { r.x,       r.y       }, c, { t.x,       t.y       } };
+        v[1] = { { r.x + r.w, r.y       }, c, { t.x + t.w, t.y       } };
+        v[2] = { { r.x + r.w, r.y + r.h }, c, { t.x + t.w, t.y + t.h } };
+        v[3] = { { r.x,       r.y + r.h }, c, { t.x,       t.y + t.h } };
+    }
+
+    renderer->DrawGeometry(m_quads[m_order[begin].index].texture, m_vertices.data(), static_cast<int>(count * 4),
+                           m_indices.data(), static_cast<int>(count * 6));
+    ++m_stats.batches;
+}
+
+void RenderQueue::Clear() {
+    m_quads.clear();
+    m_keys.clear();
+}
+
+size_t RenderQueue::Size() const {
+    return m_quads.size();
+}
+
+const RenderQueueStats& RenderQueue::GetStats() const {
+    return m_stats;
+}
@@ -48,6 +48,11 @@ void Renderer::DrawTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const
     SDL_RenderCopy(m_renderer, texture, srcRect, dstRect);
 }
 
+void Renderer::DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                            const int* indices, int numIndices) {
+    SDL_RenderGeometry(m_renderer, texture, vertices, numVertices, indices, numIndices);
+}
+
 void Renderer::DrawTextureEx(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect* dstRect,
                              double angle, SDL_Point* center, SDL_RendererFlip flip) {
     SDL_RenderCopyEx(m_renderer, texture, srcRect, dstRect, angle, center, flip);
@@ -61,6 +66,14 @@ void Renderer::DrawLine(int x1, int y1, int x2, int y2) {
     SDL_RenderDrawLine(m_renderer, x1, y1, x2, y2);
 }
 
+void Renderer::DrawLine(int x1, int y1, int x2, int y2, SDL_Color color) {
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(m_renderer, &r, &g, &b, &a);
+    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    SDL_RenderDrawLine(m_renderer, x1, y1, x2, y2);
+    SDL_SetRenderDrawColor(m_renderer, r, g, b, a);
+}
+
 void Renderer::DrawRect(const SDL_Rect& rect, bool filled) {
     if (filled) SDL_RenderFillRect(m_renderer, &rect);
     else SDL_RenderDrawRect(m_renderer, &rect);
@@ -19,9 +19,16 @@ bool Texture::LoadFromFile(const std::string& path, SDL_Renderer* renderer) {
         return false;
     }
 
+    const bool loaded = LoadFromSurface(surface, renderer);
+    SDL_FreeSurface(surface);
+    return loaded;
+}
+
+bool Texture::LoadFromSurface(SDL_Surface* surface, SDL_Renderer* renderer) {
+    Unload();
+
     // Create texture
     m_texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
 
     // Throw error if something went wrong
     if (!m_texture) {
@@ -29,6 +36,8 @@ bool Texture::LoadFromFile(const std::string& path, SDL_Renderer* renderer) {
         return false;
     }
 
+    m_width = surface->w;
+    m_height = surface->h;
     return true;
 }
 
@@ -37,6 +46,8 @@ void Texture::Unload() {
     if (m_texture) {
         SDL_DestroyTexture(m_texture);
         m_texture = nullptr;
+        m_width = 0;
+        m_height = 0;
     }
 }
 
@@ -48,3 +59,16 @@ SDL_Texture* Texture::GetSDLTexture() const {
 void Texture::SetSDLTexture(SDL_Texture* tex) {
     m_texture = tex;
 }
+
+int Texture::GetWidth() const {
+    return m_width;
+}
+
+int Texture::GetHeight() const {
+    return m_height;
+}
+
+void Texture::SetSize(int width, int height) {
+    m_width = width;
+    m_height = height;
+}
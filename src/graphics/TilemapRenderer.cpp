@@ -0,0 +1,290 @@
+#include "graphics/TilemapRenderer.h"
+#include "graphics/Texture.h"
+#include "level_manager/LevelData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+TilemapRenderer::TilemapRenderer(int chunkSize) : m_chunkSize{std::max(1, chunkSize)} {}
+
+TilemapRenderer::~TilemapRenderer() {
+    ReleaseChunks();
+}
+
+bool TilemapRenderer::LoadFromFile(const std::string& path, const AssetManager& assets) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "TilemapRenderer: Failed to open " << path << "\n";
+        return false;
+    }
+
+    nlohmann::json j;
+    try {
+        file >> j;
+    } catch (const std::exception& e) {
+        std::cerr << "TilemapRenderer: JSON parse error: " << e.what() << "\n";
+        return false;
+    }
+    return LoadFromJson(j, assets);
+}
+
+bool TilemapRenderer::LoadFromJson(const nlohmann::json& j, const AssetManager& assets) {
+    if (!j.contains("rows") || !j["rows"].is_array()) {
+        std::cerr << "TilemapRenderer: missing \"rows\"\n";
+        return false;
+    }
+    if (!j.contains("tileset") || !j.contains("tiles")) {
+        std::cerr << "TilemapRenderer: missing \"tileset\" or \"tiles\"\n";
+        return false;
+    }
+
+    const auto& tileset = j["tileset"];
+    const TextureRegion region = assets.GetRegion(tileset.value("texture", ""));
+    if (!region.texture) {
+        std::cerr << "TilemapRenderer: unknown tileset texture " << tileset.value("texture", "") << "\n";
+        return false;
+    }
+
+    const auto& rows = j["rows"];
+    int width = 0;
+    for (const auto& row : rows) {
+        width = std::max(width, static_cast<int>(row.get<std::string>().size()));
+    }
+
+    VectorFloat origin{0.0f, 0.0f};
+    if (j.contains("origin") && j["origin"].size() == 2) {
+        origin = { j["origin"][0].get<float>(), j["origin"][1].get<float>() };
+    }
+
+    const int tileSize = j.value("tileSize", 32);
+    Resize(width, static_cast<int>(rows.size()), tileSize, origin);
+    SetTileset(region, tileset.value("tileSize", tileSize));
+
+    int cells[256];
+    std::fill(std::begin(cells), std::end(cells), -1);
+    for (const auto& [key, cell] : j["tiles"].items()) {
+        if (key.size() == 1) cells[static_cast<unsigned char>(key[0])] = cell.get<int>();
+    }
+
+    for (int y = 0; y < m_height; ++y) {
+        const std::string row = rows[y].get<std::string>();
+        for (int x = 0; x < static_cast<int>(row.size()); ++x) {
+            SetTile(x, y, cells[static_cast<unsigned char>(row[x])]);
+        }
+    }
+    return true;
+}
+
+bool TilemapRenderer::LoadLevel(const LevelData& level, const AssetManager& assets) {
+    if (level.tilemapPath.empty()) return false;
+    return LoadFromFile(level.tilemapPath, assets);
+}
+
+void TilemapRenderer::Resize(int width, int height, int tileSize, VectorFloat origin) {
+    ReleaseChunks();
+
+    m_width = std::max(0, width);
+    m_height = std::max(0, height);
+    m_tileSize = std::max(1, tileSize);
+    m_chunkTiles = std::max(1, m_chunkSize / m_tileSize);
+    m_chunksX = (m_width + m_chunkTiles - 1) / m_chunkTiles;
+    m_chunksY = (m_height + m_chunkTiles - 1) / m_chunkTiles;
+    m_origin = origin;
+
+    m_tiles.assign(static_cast<size_t>(m_width) * m_height, -1);
+    m_chunks.assign(static_cast<size_t>(m_chunksX) * m_chunksY, Chunk{});
+    for (int cy = 0; cy < m_chunksY; ++cy) {
+        for (int cx = 0; cx < m_chunksX; ++cx) {
+            Chunk& chunk = m_chunks[static_cast<size_t>(cy) * m_chunksX + cx];
+            chunk.width = std::min(m_chunkTiles, m_width - cx * m_chunkTiles) * m_tileSize;
+            chunk.height = std::min(m_chunkTiles, m_height - cy * m_chunkTiles) * m_tileSize;
+        }
+    }
+    m_stats = {};
+}
+
+void TilemapRenderer::SetTileset(const TextureRegion& tileset, int cellSize) {
+    m_tileset = tileset;
+    m_cellSize = std::max(1, cellSize);
+    MarkAllDirty();
+}
+
+void TilemapRenderer::SetTile(int x, int y, int tile) {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) return;
+
+    const int16_t value = static_cast<int16_t>(std::clamp(tile, -1, 32767));
+    int16_t& current = m_tiles[static_cast<size_t>(y) * m_width + x];
+    if (current == value) return;
+
+    Chunk& chunk = ChunkAt(x, y);
+    if (current < 0) {
+        if (chunk.tiles++ == 0) ++m_stats.chunks;
+    } else if (value < 0) {
+        if (--chunk.tiles == 0) --m_stats.chunks;
+    }
+    current = value;
+
+    if (!chunk.dirty) {
+        chunk.dirty = true;
+        ++m_stats.dirty;
+    }
+}
+
+int TilemapRenderer::GetTile(int x, int y) const {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) return -1;
+    return m_tiles[static_cast<size_t>(y) * m_width + x];
+}
+
+void TilemapRenderer::MarkAllDirty() {
+    m_stats.dirty = m_chunks.size();
+    for (Chunk& chunk : m_chunks) chunk.dirty = true;
+}
+
+void TilemapRenderer::Bake(SDL_Renderer* renderer) {
+    m_stats.baked = 0;
+    if (!renderer || m_stats.dirty == 0) return;
+
+    // Bake into the chunk targets, then put the caller's target and colour back
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+
+    for (int cy = 0; cy < m_chunksY; ++cy) {
+        for (int cx = 0; cx < m_chunksX; ++cx) {
+            Chunk& chunk = m_chunks[static_cast<size_t>(cy) * m_chunksX + cx];
+            if (!chunk.dirty) continue;
+
+            // Empty chunks keep any old texture but are never drawn
+            if (chunk.tiles > 0 && !BakeChunk(renderer, cx, cy)) continue;
+            chunk.dirty = false;
+            --m_stats.dirty;
+        }
+    }
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+}
+
+bool TilemapRenderer::BakeChunk(SDL_Renderer* renderer, int cx, int cy) {
+    Chunk& chunk = m_chunks[static_cast<size_t>(cy) * m_chunksX + cx];
+
+    if (!chunk.texture) {
+        chunk.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                          chunk.width, chunk.height);
+        if (!chunk.texture) {
+            std::cerr << "TilemapRenderer: SDL_CreateTexture failed: " << SDL_GetError() << "\n";
+            return false;
+        }
+        SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_BLEND);
+    }
+
+    if (SDL_SetRenderTarget(renderer, chunk.texture) != 0) {
+        std::cerr << "TilemapRenderer: SDL_SetRenderTarget failed: " << SDL_GetError() << "\n";
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    SDL_Texture* tileset = m_tileset.texture ? m_tileset.texture->GetSDLTexture() : nullptr;
+    const int startX = cx * m_chunkTiles, startY = cy * m_chunkTiles;
+    const int endX = std::min(m_width, startX + m_chunkTiles), endY = std::min(m_height, startY + m_chunkTiles);
+
+    for (int y = startY; y < endY; ++y) {
+        for (int x = startX; x < endX; ++x) {
+            SDL_Rect src;
+            if (!tileset || !CellRect(GetTile(x, y), src)) continue;
+            const SDL_Rect dst = { (x - startX) * m_tileSize, (y - startY) * m_tileSize, m_tileSize, m_tileSize };
+            SDL_RenderCopy(renderer, tileset, &src, &dst);
+        }
+    }
+
+    ++m_stats.baked;
+    return true;
+}
+
+// Cells are laid out in rows across the tileset region
+bool TilemapRenderer::CellRect(int tile, SDL_Rect& rect) const {
+    if (tile < 0 || !m_tileset.texture) return false;
+
+    SDL_Rect area = m_tileset.rect;
+    if (area.w <= 0 || area.h <= 0) {
+        area = { 0, 0, m_tileset.texture->GetWidth(), m_tileset.texture->GetHeight() };
+    }
+
+    const int columns = std::max(1, area.w / m_cellSize);
+    const int rows = std::max(1, area.h / m_cellSize);
+    if (tile >= columns * rows) return false;
+
+    rect = { area.x + (tile % columns) * m_cellSize, area.y + (tile / columns) * m_cellSize, m_cellSize, m_cellSize };
+    return true;
+}
+
+void TilemapRenderer::Draw(IRenderer* renderer, SDL_Point cameraPosition, SDL_Point viewport, float zoom) {
+    m_stats.drawn = 0;
+    if (!renderer || m_chunks.empty() || zoom <= 0.0f) return;
+
+    // Chunk range under the camera rectangle, in map space
+    const int chunkPixels = m_chunkTiles * m_tileSize;
+    int startX = 0, endX = m_chunksX - 1, startY = 0, endY = m_chunksY - 1;
+    if (viewport.x > 0 && viewport.y > 0) {
+        const float left = cameraPosition.x - m_origin.x;
+        const float top = cameraPosition.y - m_origin.y;
+        startX = std::max(startX, static_cast<int>(std::floor(left / chunkPixels)));
+        startY = std::max(startY, static_cast<int>(std::floor(top / chunkPixels)));
+        endX = std::min(endX, static_cast<int>(std::floor((left + viewport.x / zoom) / chunkPixels)));
+        endY = std::min(endY, static_cast<int>(std::floor((top + viewport.y / zoom) / chunkPixels)));
+    }
+
+    for (int cy = startY; cy <= endY; ++cy) {
+        for (int cx = startX; cx <= endX; ++cx) {
+            const Chunk& chunk = m_chunks[static_cast<size_t>(cy) * m_chunksX + cx];
+            if (!chunk.texture || chunk.tiles == 0) continue;
+
+            // Both edges are rounded, so neighbouring chunks meet without seams at any zoom
+            const float worldX = m_origin.x + cx * chunkPixels - cameraPosition.x;
+            const float worldY = m_origin.y + cy * chunkPixels - cameraPosition.y;
+            const int x0 = static_cast<int>(std::floor(worldX * zoom));
+            const int y0 = static_cast<int>(std::floor(worldY * zoom));
+            const int x1 = static_cast<int>(std::floor((worldX + chunk.width) * zoom));
+            const int y1 = static_cast<int>(std::floor((worldY + chunk.height) * zoom));
+
+            const SDL_Rect dst = { x0, y0, x1 - x0, y1 - y0 };
+            renderer->DrawTexture(chunk.texture, nullptr, &dst);
+            ++m_stats.drawn;
+        }
+    }
+}
+
+TilemapRenderer::Chunk& TilemapRenderer::ChunkAt(int x, int y) {
+    return m_chunks[static_cast<size_t>(y / m_chunkTiles) * m_chunksX + x / m_chunkTiles];
+}
+
+void TilemapRenderer::ReleaseChunks() {
+    for (Chunk& chunk : m_chunks) {
+        if (chunk.texture) SDL_DestroyTexture(chunk.texture);
+        chunk.texture = nullptr;
+    }
+}
+
+// Getters
+bool TilemapRenderer::IsLoaded() const {
+    return !m_chunks.empty();
+}
+
+int TilemapRenderer::GetChunkTiles() const {
+    return m_chunkTiles;
+}
+
+int TilemapRenderer::GetChunkCountX() const {
+    return m_chunksX;
+}
+
+int TilemapRenderer::GetChunkCountY() const {
+    return m_chunksY;
+}
+
+const TilemapStats& TilemapRenderer::GetStats() const {
+    return m_stats;
+}
@@ -1,6 +1,9 @@
 #include "level_manager/AssetManager.h"
+#include "graphics/AtlasPacker.h"
 #include "graphics/Texture.h"
 #include "graphics/Renderer.h"
+#include <SDL_image.h>
+#include <algorithm>
 #include <iostream>
 
 AssetManager::AssetManager(Renderer* renderer)
@@ -22,10 +25,121 @@ bool AssetManager::LoadTexture(const std::string& key, const std::string& path)
 }
 
 Texture* AssetManager::GetTexture(const std::string& key) const {
+    auto region = m_regions.find(key);
+    if (region != m_regions.end()) return region->second.texture;
+
     auto it = m_textures.find(key);
     return it != m_textures.end() ? it->second.get() : nullptr;
 }
 
 void AssetManager::UnloadAll() {
     m_textures.clear();
+    m_pending.clear();
+    m_regions.clear();
+    m_atlasPages.clear();
+}
+
+void AssetManager::QueueAtlasImage(const std::string& key, const std::string& path) {
+    m_pending.push_back({ key, path });
+}
+
+// Pack every queued image; oversized ones fall back to standalone textures
+bool AssetManager::BuildAtlas(const AtlasSettings& settings) {
+    if (!m_renderer) return false;
+
+    struct Image {
+        std::string key;
+        SDL_Surface* surface;
+    };
+    std::vector<Image> packed;
+
+    bool ok = true;
+    for (const PendingImage& pending : m_pending) {
+        SDL_Surface* surface = IMG_Load(pending.path.c_str());
+        if (!surface) {
+            std::cerr << "AssetManager: Failed to load image '" << pending.path << "': " << IMG_GetError() << "\n";
+            ok = false;
+            continue;
+        }
+
+        const int padded = std::max(surface->w, surface->h) + settings.padding * 2;
+        if (std::max(surface->w, surface->h) > settings.maxImageSize || padded > settings.pageSize) {
+            auto tex = std::make_unique<Texture>();
+            if (tex->LoadFromSurface(surface, m_renderer->GetSDLRenderer())) {
+                m_textures[pending.key] = std::move(tex);
+            } else {
+                ok = false;
+            }
+            SDL_FreeSurface(surface);
+            continue;
+        }
+        packed.push_back({ pending.key, surface });
+    }
+    m_pending.clear();
+
+    // Tallest first packs tighter on a skyline; key order keeps the layout reproducible
+    std::sort(packed.begin(), packed.end(), [](const Image& a, const Image& b) {
+        if (a.surface->h != b.surface->h) return a.surface->h > b.surface->h;
+        return a.key < b.key;
+    });
+
+    AtlasPacker packer(settings.pageSize, settings.pageSize);
+    std::vector<AtlasSlot> slots(packed.size());
+    for (size_t i = 0; i < packed.size(); ++i) {
+        const SDL_Surface* s = packed[i].surface;
+        packer.Insert(s->w + settings.padding * 2, s->h + settings.padding * 2, slots[i]);
+    }
+
+    // Pages are only as tall as their content
+    const size_t firstPage = m_atlasPages.size();
+    std::vector<SDL_Surface*> pages;
+    for (int p = 0; p < packer.GetPageCount(); ++p) {
+        SDL_Surface* page = SDL_CreateRGBSurfaceWithFormat(0, settings.pageSize, packer.GetUsedHeight(p),
+                                                           32, SDL_PIXELFORMAT_RGBA32);
+        if (!page) {
+            std::cerr << "AssetManager: Failed to create atlas page: " << SDL_GetError() << "\n";
+            ok = false;
+        } else {
+            SDL_FillRect(page, nullptr, 0);
+        }
+        pages.push_back(page);
+    }
+
+    for (size_t i = 0; i < packed.size(); ++i) {
+        SDL_Surface* image = packed[i].surface;
+        SDL_Surface* page = pages[slots[i].page];
+        SDL_Rect dst{ slots[i].x + settings.padding, slots[i].y + settings.padding, image->w, image->h };
+
+        if (page) {
+            // Copy alpha as is instead of blending onto the transparent page
+            SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(image, nullptr, page, &dst);
+        }
+        m_regions[packed[i].key] = { nullptr, dst };
+        SDL_FreeSurface(image);
+    }
+
+    for (size_t p = 0; p < pages.size(); ++p) {
+        auto tex = std::make_unique<Texture>();
+        if (!pages[p] || !tex->LoadFromSurface(pages[p], m_renderer->GetSDLRenderer())) ok = false;
+        if (pages[p]) SDL_FreeSurface(pages[p]);
+        m_atlasPages.push_back(std::move(tex));
+    }
+
+    for (size_t i = 0; i < packed.size(); ++i) {
+        m_regions[packed[i].key].texture = m_atlasPages[firstPage + slots[i].page].get();
+    }
+    return ok;
+}
+
+TextureRegion AssetManager::GetRegion(const std::string& key) const {
+    auto region = m_regions.find(key);
+    if (region != m_regions.end()) return region->second;
+
+    auto it = m_textures.find(key);
+    return { it != m_textures.end() ? it->second.get() : nullptr, {0, 0, 0, 0} };
+}
+
+size_t AssetManager::GetAtlasPageCount() const {
+    return m_atlasPages.size();
 }
@@ -26,6 +26,7 @@
 #include "AI/AISystem.h"
 
 #include "graphics/Renderer.h"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <unordered_map>
@@ -72,6 +73,16 @@ bool ResourceLoader::LoadScene(const std::string& path) {
         LoadAssets(j["assets"]);
     }
 
+    m_tilemapPath = j.value("tilemap", "");
+
+    m_level = LevelData{};
+    if (j.contains("level")) {
+        const json& level = j["level"];
+        m_level.gravity = level.value("gravity", m_level.gravity);
+        m_level.ambientWindX = level.value("ambientWindX", m_level.ambientWindX);
+        m_level.ambientWindY = level.value("ambientWindY", m_level.ambientWindY);
+    }
+
     if (j.contains("prefabs")) {
         LoadPrefabs(j["prefabs"]);
     }
@@ -85,16 +96,47 @@ bool ResourceLoader::LoadScene(const std::string& path) {
 
 void ResourceLoader::UnloadScene() {
     if (m_assets) m_assets->UnloadAll();
+    m_tilemapPath.clear();
+    m_level = LevelData{};
+}
+
+const std::string& ResourceLoader::GetTilemapPath() const {
+    return m_tilemapPath;
+}
+
+const LevelData& ResourceLoader::GetLevel() const {
+    return m_level;
 }
 
 void ResourceLoader::LoadAssets(const json& j) {
     if (!j.contains("textures")) return;
+
+    // Optional atlas: packed at load, "exclude" keys (e.g. backgrounds) stay standalone
+    AtlasSettings atlas;
+    std::vector<std::string> exclude;
+    if (j.contains("atlas")) {
+        const auto& a = j["atlas"];
+        atlas.enabled      = a.value("enabled", true);
+        atlas.pageSize     = a.value("pageSize", atlas.pageSize);
+        atlas.padding      = a.value("padding", atlas.padding);
+        atlas.maxImageSize = a.value("maxImageSize", atlas.maxImageSize);
+        if (a.contains("exclude")) exclude = a["exclude"].get<std::vector<std::string>>();
+    }
+
     for (auto& [key, path] : j["textures"].items()) {
+        if (atlas.enabled && std::find(exclude.begin(), exclude.end(), key) == exclude.end()) {
+            m_assets->QueueAtlasImage(key, path.get<std::string>());
+            continue;
+        }
         if (!m_assets->LoadTexture(key, path.get<std::string>())) {
             std::cerr << "ResourceLoader: Failed to load texture " << key
                       << " -> " << path << "\n";
         }
     }
+
+    if (atlas.enabled && !m_assets->BuildAtlas(atlas)) {
+        std::cerr << "ResourceLoader: Texture atlas built with errors\n";
+    }
 }
 
 void ResourceLoader::LoadPrefabs(const json& j) {
@@ -296,9 +338,13 @@ BoundryComponent ResourceLoader::ParseBoundry(const json& j) {
 SpriteComponent ResourceLoader::ParseSprite(const json& j) {
     SpriteComponent s;
     std::string texKey = j.value("texture", "");
-    s.texture = m_assets->GetTexture(texKey);
+    const TextureRegion region = m_assets->GetRegion(texKey);
+    s.texture = region.texture;
+    s.srcRect = region.rect;
     s.width   = j.value("w", 0);
     s.height  = j.value("h", 0);
+    s.layer   = j.value("layer", 0);
+    s.ySort   = j.value("ySort", false);
     return s;
 }
 
@@ -317,6 +363,8 @@ ColliderComponent ResourceLoader::ParseCollider(const json& j) {
     c.height = j.value("h", 0);
     c.layer  = StringToLayer(j.value("layer", "None"));
     c.mask   = StringToLayer(j.value("mask", "All"));
+    c.continuous = j.value("continuous", false);
+    c.isTrigger = j.value("trigger", false);
     return c;
 }
 
@@ -417,7 +465,9 @@ FrameAnimationClip* ResourceLoader::ParseFrameClip(const json& j) {
     for (auto& f : j["frames"]) {
         Frame frame;
         std::string texKey = f.value("texture", "");
-        frame.texture      = m_assets->GetTexture(texKey);
+        const TextureRegion region = m_assets->GetRegion(texKey);
+        frame.texture      = region.texture;
+        frame.srcRect      = region.rect;
         frame.duration     = f.value("duration", 0.1f);
         clip->frames.push_back(frame);
     }
@@ -1,6 +1,8 @@
 #include <SDL2/SDL.h>
 #include <SDL_image.h>
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 #include "core/EntityManager.h"
 #include "systems/EntityCreationSystem.h"
@@ -9,6 +11,7 @@
 #include "AI/AISystem.h"
 #include "event/core/EventBus.h"
 #include "event/custom_events/CollisionEvent.h"
+#include "event/custom_events/TriggerEvent.h"
 
 #include "components/TransformComponent.h"
 #include "components/VelocityComponent.h"
@@ -20,19 +23,32 @@
 #include "components/SurfaceComponent.h"
 #include "utils/AnimationUtils.h"
 #include "components/PhysicsComponent.h"
+#include "components/JointComponent.h"
+#include "components/ForceFieldComponent.h"
+#include "components/CharacterControllerComponent.h"
 
 #include "systems/MovementSystem.h"
 #include "systems/AudioSystem.h"
 #include "systems/RenderSystem.h"
 #include "systems/BoundrySystem.h"
 #include "systems/CollisionSystem.h"
+#include "systems/TriggerSystem.h"
+#include "systems/TileCollisionMap.h"
+#include "core/JobSystem.h"
 #include "systems/CameraSystem.h"
 #include "systems/SurfaceBehaviorSystem.h"
 #include "systems/AnimationSystem.h"
 #include "systems/PhysicsSystem.h"
+#include "systems/ConstraintSolver.h"
+#include "systems/ForceFields.h"
+#include "systems/CharacterControllerSystem.h"
+#include "systems/SpatialQuery.h"
+#include "systems/ParticleSystem.h"
 
 #include "window/Window.h"
 #include "graphics/Renderer.h"
+#include "graphics/RenderFrames.h"
+#include "graphics/TilemapRenderer.h"
 #include "input/InputManager.h"
 #include "event/core/EventBus.h"
 #include "event/custom_events/CollisionEvent.h"
@@ -41,15 +57,15 @@
 #include "level_manager/AssetManager.h"
 #include "level_manager/ResourceLoader.h"
 
-void DrawGrid(SDL_Renderer* sdlRenderer, const SDL_Point& camPos, int width, int height, int cellSize = 64) {
-    SDL_SetRenderDrawColor(sdlRenderer, 80, 80, 80, 255);
+void DrawGrid(IRenderer& renderer, const SDL_Point& camPos, int width, int height, int cellSize = 64) {
+    const SDL_Color color = {80, 80, 80, 255};
 
     for (int x = - (camPos.x % cellSize); x < width; x += cellSize) {
-        SDL_RenderDrawLine(sdlRenderer, x, 0, x, height);
+        renderer.DrawLine(x, 0, x, height, color);
     }
 
     for (int y = - (camPos.y % cellSize); y < height; y += cellSize) {
-        SDL_RenderDrawLine(sdlRenderer, 0, y, width, y);
+        renderer.DrawLine(0, y, width, y, color);
     }
 }
 
@@ -78,6 +94,9 @@ int main(int argc, char* argv[]) {
     ComponentStorage<SurfaceComponent> surfaces;
     ComponentStorage<AnimationComponent> animations;
     ComponentStorage<PhysicsComponent> physics;
+    ComponentStorage<JointComponent> joints;
+    ComponentStorage<ForceFieldComponent> forceFieldVolumes;
+    ComponentStorage<CharacterControllerComponent> characterControllers;
 
     // Register storages
     creationSystem.RegisterStorage(&transforms);
@@ -90,6 +109,9 @@ int main(int argc, char* argv[]) {
     creationSystem.RegisterStorage(&surfaces);
     creationSystem.RegisterStorage(&animations);
     creationSystem.RegisterStorage(&physics);
+    creationSystem.RegisterStorage(&joints);
+    creationSystem.RegisterStorage(&forceFieldVolumes);
+    creationSystem.RegisterStorage(&characterControllers);
 
     entityManager.RegisterComponentStorage(&transforms);
     entityManager.RegisterComponentStorage(&velocities);
@@ -101,6 +123,9 @@ int main(int argc, char* argv[]) {
     entityManager.RegisterComponentStorage(&surfaces);
     entityManager.RegisterComponentStorage(&animations);
     entityManager.RegisterComponentStorage(&physics);
+    entityManager.RegisterComponentStorage(&joints);
+    entityManager.RegisterComponentStorage(&forceFieldVolumes);
+    entityManager.RegisterComponentStorage(&characterControllers);
 
     // Window + Renderer
     Window window;
@@ -108,6 +133,9 @@ int main(int argc, char* argv[]) {
     if (!window.Init("Game", 1200, 720, false)) return -1;
     if (!renderer.Init(window.GetSDLWindow())) return -1;
 
+    // Window size for the simulation thread, refreshed after every PollEvents
+    std::atomic<SDL_Point> screenSize{ SDL_Point{ window.GetWidth(), window.GetHeight() } };
+
     // Asset Manager + Loader + required Systems
     AssetManager assets(&renderer);
     AISystem ai;
@@ -147,15 +175,37 @@ int main(int argc, char* argv[]) {
     systemManager.RegisterSystem<AudioSystem>(&entityManager);
     systemManager.RegisterSystem<AnimationSystem>(animations, sprites, transforms);
     systemManager.RegisterSystem<CollisionSystem>(entityManager, transforms, colliders);
+    systemManager.RegisterSystem<CharacterControllerSystem>(transforms, colliders, characterControllers);  // after the broadphase
     systemManager.RegisterSystem<PhysicsSystem>(transforms, accelerations, physics);
-    systemManager.RegisterSystem<BoundrySystem>(transforms, boundaries, physics, &window);
+    systemManager.RegisterSystem<BoundrySystem>(transforms, boundaries, physics, &screenSize);
+    systemManager.RegisterSystem<TriggerSystem>(transforms, colliders);  // after physics and boundaries moved bodies
     SpatialGrid<EntityID> spatialGrid;
     systemManager.RegisterSystem<SurfaceBehaviorSystem>(transforms, velocities, surfaces, physics, spatialGrid);
     systemManager.RegisterSystem<AISystem>(ai);
+    systemManager.RegisterSystem<ParticleSystem>();
 
 
     renderSystem.AddBackgroundLayer(assets.GetTexture("background"), 0.0f);
 
+    // Effects
+    auto* particles = systemManager.GetSystem<ParticleSystem>();
+    renderSystem.SetParticleSystem(particles);
+
+    ParticleEmitterConfig sparkConfig;
+    sparkConfig.capacity = 512;
+    sparkConfig.lifetimeMin = 0.2f;
+    sparkConfig.lifetimeMax = 0.5f;
+    sparkConfig.speedMin = 80.0f;
+    sparkConfig.speedMax = 220.0f;
+    sparkConfig.direction = -90.0f;
+    sparkConfig.spread = 140.0f;
+    sparkConfig.gravity = {0.0f, 600.0f};
+    sparkConfig.startSize = 4.0f;
+    sparkConfig.endSize = 1.0f;
+    sparkConfig.colorMin = {255, 180, 60, 255};
+    sparkConfig.colorMax = {255, 240, 160, 255};
+    const ParticleEmitterID sparks = particles->CreateEmitter(sparkConfig, {0.0f, 0.0f});
+
     // Audio
     auto* audioSystem = systemManager.GetSystem<AudioSystem>();
 
@@ -199,7 +249,9 @@ int main(int argc, char* argv[]) {
     auto* cam = systemManager.GetSystem<CameraSystem>();
     auto* phys = systemManager.GetSystem<PhysicsSystem>();
 
-    phys->SetGravity(90.00f);
+    phys->ApplyLevel(loader.GetLevel());
+    phys->SetSubsteps(4);
+    phys->SetAdaptiveSubsteps(true);
     
     cam->SetActiveCamera(player);
     cam->FocusOn(player);
@@ -209,10 +261,17 @@ int main(int argc, char* argv[]) {
             if ((e.entityA == 1 && e.entityB == 4) ||
                 (e.entityA == 4 && e.entityB == 1))
             {
-                auto* phys = physics.Get(1);
-                if (!phys) return;
-                
-                phys->impulse.y -= 20;
+                // With a tile map the player is a character controller, not a rigid body
+                if (auto* phys = physics.Get(1)) {
+                    phys->impulse.y -= 20;
+                } else if (auto* controller = characterControllers.Get(1)) {
+                    controller->velocity.y -= 20;
+                }
+
+                if (auto* t = transforms.Get(1)) {
+                    particles->SetEmitterPosition(sparks, t->position);
+                    particles->Burst(sparks, 24);
+                }
                 int ch = Mix_PlayChannel(-1, bounce.chunk, 0);
                 Mix_Volume(ch, MIX_MAX_VOLUME * 0.2);
             }
@@ -220,38 +279,133 @@ int main(int argc, char* argv[]) {
     );
 
     auto* collisionSystem = systemManager.GetSystem<CollisionSystem>();
+    phys->SetCollisionSystem(collisionSystem);
+    collisionSystem->SetPhysics(&physics);
 
-    while (window.IsRunning()) {
-        window.PollEvents();
-        input.Update();
+    ConstraintSolver contactSolver(transforms, colliders, physics);
+    contactSolver.SetJoints(&joints);
+    phys->SetConstraintSolver(&contactSolver);
+
+    ForceFields forceFields(transforms, forceFieldVolumes);
+    phys->SetForceFields(&forceFields);
+
+    // Static level geometry
+    TileCollisionMap tileMap;
+    if (!loader.GetTilemapPath().empty() && tileMap.LoadFromFile(loader.GetTilemapPath())) {
+        phys->SetTileMap(&tileMap, &colliders);
+    }
 
-        // Player movement
-        if (auto* velocity = physics.Get(player)) {
-            if (input.IsActionHeld("Left"))  velocity->impulse.x -= 10;
-            if (input.IsActionHeld("Right")) velocity->impulse.x += 10;
-            if (input.IsActionHeld("Up")) velocity->impulse.y -= 10;
-            if (input.IsActionHeld("Down")) velocity->impulse.y += 10;
+    // Tile layer from the same file, baked into chunk textures before the simulation thread starts
+    TilemapRenderer tilemap;
+    const bool hasTilemap = !loader.GetTilemapPath().empty() &&
+                            tilemap.LoadFromFile(loader.GetTilemapPath(), assets);
+    if (hasTilemap) {
+        tilemap.Bake(renderer.GetSDLRenderer());
+        renderSystem.SetTilemap(&tilemap);
+    }
+
+    JobSystem jobSystem;
+    collisionSystem->SetJobSystem(&jobSystem);
+    contactSolver.SetJobSystem(&jobSystem);
+    contactSolver.SetIslandSolving(true);
+
+    auto* triggerSystem = systemManager.GetSystem<TriggerSystem>();
+
+    SpatialQuery spatialQuery(*collisionSystem);
+    ai.SetSpatialQuery(&spatialQuery);
+
+    // Walkers: swept against the broadphase and the tile map, no rigid body
+    auto* characterSystem = systemManager.GetSystem<CharacterControllerSystem>();
+    characterSystem->SetSpatialQuery(&spatialQuery);
+    if (tileMap.IsLoaded()) {
+        characterSystem->SetTileMap(&tileMap);
+
+        // With level geometry to stand on, the player walks and jumps instead of being pushed around
+        if (colliders.Has(player)) {
+            physics.Remove(player);
+            characterControllers.Add(player, CharacterControllerComponent{});
         }
+    }
 
-        systemManager.UpdateAll(dt);
-        for (auto& [a, b] : collisionSystem->GetCollisions()) {
-            eventBus.PublishImmediate(CollisionEvent(a, b, "", ""));
+    // SDL wants events and the renderer on the thread that created the window, so this thread
+    // renders and the simulation runs on a worker, recording each frame into a command list.
+    // Frame N is presented while frame N+1 is simulated.
+    enum : uint8_t { HELD_LEFT = 1, HELD_RIGHT = 2, HELD_UP = 4, HELD_DOWN = 8 };
+    std::atomic<uint8_t> held{0};
+    std::atomic<bool> simulating{true};
+    RenderFrames frames;
+
+    std::thread simulation([&] {
+        while (simulating.load()) {
+            const uint8_t keys = held.load();
+
+            // Player movement
+            if (auto* controller = characterControllers.Get(player)) {
+                controller->moveX = ((keys & HELD_RIGHT) ? 1.0f : 0.0f) - ((keys & HELD_LEFT) ? 1.0f : 0.0f);
+                controller->jump = (keys & HELD_UP) != 0;
+            } else if (auto* velocity = physics.Get(player)) {
+                if (keys & HELD_LEFT)  velocity->impulse.x -= 10;
+                if (keys & HELD_RIGHT) velocity->impulse.x += 10;
+                if (keys & HELD_UP) velocity->impulse.y -= 10;
+                if (keys & HELD_DOWN) velocity->impulse.y += 10;
+            }
+
+            systemManager.UpdateAll(dt);
+            for (auto& [a, b] : collisionSystem->GetCollisions()) {
+                eventBus.PublishImmediate(CollisionEvent(a, b, "", ""));
+            }
+            for (auto& [a, b] : collisionSystem->GetSweptContacts()) {
+                eventBus.PublishImmediate(CollisionEvent(a, b, "", ""));
+            }
+            for (auto& [a, b] : characterSystem->GetContacts()) {
+                eventBus.PublishImmediate(CollisionEvent(a, b, "", ""));
+            }
+            for (const auto& e : triggerSystem->GetEvents()) {
+                eventBus.PublishImmediate(e);
+            }
+
+            cam->ApplyToRenderSystem(renderSystem);
+            ai.Update(dt);
+
+            RenderCommandList& list = frames.BeginRecord();
+            renderSystem.SetRenderer(&list);
+            renderSystem.Update(dt);
+            DrawGrid(list, renderSystem.GetCameraPosition(), 1200, 720, 64);
+            frames.Publish();
         }
+    });
 
-        cam->ApplyToRenderSystem(renderSystem);
-        ai.Update(dt);
+    while (window.IsRunning()) {
+        window.PollEvents();
+        screenSize.store(SDL_Point{ window.GetWidth(), window.GetHeight() });
+        input.Update();
 
-        renderer.Clear();
-        renderSystem.Update(dt);
+        held.store((input.IsActionHeld("Left") ? HELD_LEFT : 0) |
+                   (input.IsActionHeld("Right") ? HELD_RIGHT : 0) |
+                   (input.IsActionHeld("Up") ? HELD_UP : 0) |
+                   (input.IsActionHeld("Down") ? HELD_DOWN : 0));
 
-        SDL_Point camPos = renderSystem.GetCameraPosition();
-        DrawGrid(renderer.GetSDLRenderer(), camPos, 1200, 720, 64);
+        // Lost chunk contents are re-baked before the frame that blits them
+        if (hasTilemap && window.ConsumeRenderTargetsReset()) tilemap.MarkAllDirty();
 
+        // A slow simulation frame must not stall events: present the last frame again instead
+        if (hasTilemap) tilemap.Bake(renderer.GetSDLRenderer());  // no-op when nothing is dirty
+        renderer.Clear();
+        if (const RenderCommandList* list = frames.TryAcquire()) {
+            list->Execute(renderer);
+            frames.Release();
+        } else {
+            frames.GetLast().Execute(renderer);
+        }
         renderer.Present();
 
         SDL_Delay(1000 / 60);
     }
 
+    simulating = false;
+    frames.Stop();
+    simulation.join();
+
     window.Shutdown();
     renderer.Shutdown();
     IMG_Quit();
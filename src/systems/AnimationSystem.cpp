@@ -43,10 +43,10 @@ void AnimationSystem::ApplyLayer(EntityID entity, const AnimationLayer& layer) {
     if (layer.type == AnimationType::FRAME_BASED) {
         const auto* clip = static_cast<const FrameAnimationClip*>(layer.clip);
         int frameIndex = GetFrameIndex(*clip, layer.time);
-        Texture* tex = clip->frames[frameIndex].texture;
+        const Frame& frame = clip->frames[frameIndex];
 
         if (auto* sc = m_sprites.Get(entity)) {
-            sc->SetTexture(tex);
+            sc->SetTexture(frame.texture, frame.srcRect);
         }
     } else {
         const auto* clip = static_cast<const SkeletalAnimationClip*>(layer.clip);
@@ -0,0 +1,62 @@
+#include "systems/BodySets.h"
+
+#include <algorithm>
+
+namespace {
+    // Entities without an AccelerationComponent point here, the loops never branch on it
+    const AccelerationComponent NO_ACCELERATION{};
+}
+
+BodySets::BodySets(ComponentStorage<TransformComponent>& transforms,
+                   ComponentStorage<AccelerationComponent>& accelerations,
+                   ComponentStorage<PhysicsComponent>& physics,
+                   ComponentStorage<VelocityComponent>* velocities)
+    : m_transforms{transforms}, m_accelerations{accelerations}, m_physics{physics}, m_velocities{velocities} {}
+
+bool BodySets::Refresh() {
+    const uint64_t versions[4] = {
+        m_transforms.GetVersion(),
+        m_accelerations.GetVersion(),
+        m_physics.GetVersion(),
+        m_velocities ? m_velocities->GetVersion() : 0
+    };
+    if (m_built && std::equal(std::begin(versions), std::end(versions), std::begin(m_versions))) return false;
+
+    std::copy(std::begin(versions), std::end(versions), std::begin(m_versions));
+    if (m_velocities) RebuildKinematic();
+    else RebuildDynamic();
+    m_built = true;
+    return true;
+}
+
+void BodySets::RebuildDynamic() {
+    m_dynamic.clear();
+    for (auto& [id, phys] : m_physics.GetAll()) {
+        auto* transform = m_transforms.Get(id);
+        if (!transform) continue;
+
+        const auto* accel = m_accelerations.Get(id);
+        m_dynamic.push_back({ id, &phys, transform, accel ? accel : &NO_ACCELERATION });
+    }
+    std::sort(m_dynamic.begin(), m_dynamic.end(),
+              [](const DynamicBody& a, const DynamicBody& b) { return a.id < b.id; });
+}
+
+// Entities with a PhysicsComponent belong to the PhysicsSystem
+void BodySets::RebuildKinematic() {
+    m_kinematic.clear();
+    for (auto& [id, velocity] : m_velocities->GetAll()) {
+        if (m_physics.Has(id)) continue;
+
+        auto* transform = m_transforms.Get(id);
+        if (!transform) continue;
+
+        const auto* accel = m_accelerations.Get(id);
+        m_kinematic.push_back({ id, transform, &velocity, accel ? accel : &NO_ACCELERATION });
+    }
+    std::sort(m_kinematic.begin(), m_kinematic.end(),
+              [](const KinematicBody& a, const KinematicBody& b) { return a.id < b.id; });
+}
+
+const std::vector<KinematicBody>& BodySets::GetKinematic() const { return m_kinematic; }
+const std::vector<DynamicBody>& BodySets::GetDynamic() const { return m_dynamic; }
@@ -3,14 +3,16 @@
 BoundrySystem::BoundrySystem(ComponentStorage<TransformComponent>& transforms,
                              ComponentStorage<BoundryComponent>& boundaries,
                              ComponentStorage<PhysicsComponent>& physics,
-                             Window* window)
+                             const std::atomic<SDL_Point>* screenSize)
     : m_transforms{transforms}, m_boundaries{boundaries}, 
-      m_physics{physics}, m_window{window} {}
+      m_physics{physics}, m_screenSize{screenSize} {}
 
 // Update state
 void BoundrySystem::Update(float deltaTime) {
-    const int screenWidth = m_window->GetWidth();
-    const int screenHeight = m_window->GetHeight();
+    // One snapshot, so width and height always come from the same resize
+    const SDL_Point screenSize = m_screenSize->load();
+    const int screenWidth = screenSize.x;
+    const int screenHeight = screenSize.y;
 
     for (auto& [id, boundry] : m_boundaries.GetAll()) {
         auto* transform = m_transforms.Get(id);
@@ -0,0 +1,173 @@
+#include "systems/CharacterControllerSystem.h"
+#include "systems/SpatialQuery.h"
+#include "systems/TileCollisionMap.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float SKIN = 0.01f;      // px kept from broadphase boxes, so the next sweep starts outside them
+    constexpr float MIN_PROGRESS = 0.05f;  // px a step-up must gain over the blocked move
+    constexpr float DEG_TO_RAD = 3.14159265f / 180.0f;
+}
+
+CharacterControllerSystem::CharacterControllerSystem(ComponentStorage<TransformComponent>& transforms,
+                                                     ComponentStorage<ColliderComponent>& colliders,
+                                                     ComponentStorage<CharacterControllerComponent>& controllers)
+    : m_transforms{transforms}, m_colliders{colliders}, m_controllers{controllers} {}
+
+void CharacterControllerSystem::Update(float deltaTime) {
+    m_stats = {};
+    m_contacts.clear();
+    if (deltaTime <= 0.0f) return;
+
+    for (auto& [id, controller] : m_controllers.GetAll()) {
+        auto* transform = m_transforms.Get(id);
+        const auto* collider = m_colliders.Get(id);
+        if (!transform || !collider) continue;
+
+        Step(id, controller, *transform, *collider, deltaTime);
+        ++m_stats.controllers;
+    }
+}
+
+void CharacterControllerSystem::Step(EntityID id, CharacterControllerComponent& controller,
+                                     TransformComponent& transform, const ColliderComponent& collider,
+                                     float deltaTime) {
+    const CollisionLayer mask = collider.mask;
+    AABB box{ transform.position.x, transform.position.y,
+              static_cast<float>(collider.width), static_cast<float>(collider.height) };
+
+    // Coyote time: the timer is full while grounded and runs out in the air
+    const bool wasGrounded = controller.isGrounded;
+    controller.coyoteTimer = wasGrounded ? controller.coyoteTime
+                                         : std::max(0.0f, controller.coyoteTimer - deltaTime);
+
+    bool jumped = false;
+    if (controller.jump && controller.coyoteTimer > 0.0f) {
+        controller.velocity.y = -controller.jumpSpeed;
+        controller.coyoteTimer = 0.0f;
+        jumped = true;
+    }
+    controller.jump = false;
+
+    controller.velocity.x = std::clamp(controller.moveX, -1.0f, 1.0f) * controller.moveSpeed;
+    controller.velocity.y = std::min(controller.velocity.y + controller.gravity * deltaTime, controller.maxFallSpeed);
+    controller.hitWall = false;
+    controller.hitCeiling = false;
+
+    // X: slide along walls, climb low ledges, refuse steep slopes
+    const float dx = controller.velocity.x * deltaTime;
+    if (dx != 0.0f) {
+        MoveResult x = Move(id, box, { dx, 0.0f }, mask);
+        if (IsTooSteep(x.delta, controller.maxSlope)) {
+            x.delta = { 0.0f, 0.0f };
+            x.blockedX = true;
+        }
+
+        const bool canStep = x.blockedX && wasGrounded && !jumped && controller.stepHeight > 0.0f;
+        if (!canStep || !StepUp(id, box, dx, x.delta.x, controller.stepHeight, mask)) {
+            box.x += x.delta.x;
+            box.y += x.delta.y;  // slope tiles lift the box
+            controller.hitWall = x.blockedX;
+            AddContact(id, x);
+        }
+    }
+
+    // Y: land, bump the ceiling or fall
+    const float dy = controller.velocity.y * deltaTime;
+    const MoveResult y = Move(id, box, { 0.0f, dy }, mask);
+    box.y += y.delta.y;
+    AddContact(id, y);
+
+    bool grounded = dy >= 0.0f && y.blockedDown;
+    if (y.blockedUp && controller.velocity.y < 0.0f) {
+        controller.velocity.y = 0.0f;
+        controller.hitCeiling = true;
+    }
+
+    // Ground snap: walking down a step or a slope shouldn't turn into a fall
+    if (!grounded && wasGrounded && !jumped && controller.snapDistance > 0.0f) {
+        const MoveResult snap = Move(id, box, { 0.0f, controller.snapDistance }, mask);
+        if (snap.blockedDown) {
+            box.y += snap.delta.y;
+            grounded = true;
+            AddContact(id, snap);
+        }
+    }
+
+    if (grounded) controller.velocity.y = 0.0f;
+    controller.isGrounded = grounded;
+    transform.position = { box.x, box.y };
+}
+
+// One swept query against the broadphase, then the tile map sweep on what is left
+CharacterControllerSystem::MoveResult CharacterControllerSystem::Move(EntityID id, const AABB& box,
+                                                                      const VectorFloat& delta, CollisionLayer mask) {
+    MoveResult result;
+    result.delta = delta;
+
+    SweepHit hit;
+    if (m_spatialQuery) {
+        ++m_stats.sweeps;
+        if (m_spatialQuery->SweepBox(box, delta, hit, mask, id)) {
+            const float length = delta.Length();
+            const float travel = std::max(0.0f, length * hit.toi - SKIN);
+            result.delta = delta * (travel / length);
+
+            result.blockedX = hit.normal.x != 0.0f;
+            result.blockedDown = hit.normal.y < 0.0f;  // normal points up at the walker
+            result.blockedUp = hit.normal.y > 0.0f;
+            result.other = hit.entity;
+        }
+    }
+
+    if (m_tileMap) {
+        TileContact contact;
+        result.delta = m_tileMap->Move(box, result.delta, contact);
+        result.blockedX |= contact.left || contact.right;
+        result.blockedDown |= contact.ground;
+        result.blockedUp |= contact.ceiling;
+    }
+    return result;
+}
+
+// Up by stepHeight, across, back down; only kept if it lands and gets further than the blocked move
+bool CharacterControllerSystem::StepUp(EntityID id, AABB& box, float dx, float blockedDx, float stepHeight,
+                                       CollisionLayer mask) {
+    AABB probe = box;
+
+    const MoveResult up = Move(id, probe, { 0.0f, -stepHeight }, mask);
+    probe.y += up.delta.y;
+
+    const MoveResult across = Move(id, probe, { dx, 0.0f }, mask);
+    if (std::abs(across.delta.x) < std::abs(blockedDx) + MIN_PROGRESS) return false;
+    probe.x += across.delta.x;
+    probe.y += across.delta.y;
+
+    const MoveResult down = Move(id, probe, { 0.0f, -up.delta.y }, mask);
+    if (!down.blockedDown) return false;  // no ledge under the feet
+    probe.y += down.delta.y;
+
+    box = probe;
+    return true;
+}
+
+// Slope tiles lift the box during the X move; rise / run over tan(maxSlope) is too steep
+bool CharacterControllerSystem::IsTooSteep(const VectorFloat& delta, float maxSlope) const {
+    if (delta.y >= 0.0f || delta.x == 0.0f) return false;
+    return -delta.y > std::abs(delta.x) * std::tan(maxSlope * DEG_TO_RAD) + SKIN;
+}
+
+// Once per walker and collider, the X and Y moves often hit the same box
+void CharacterControllerSystem::AddContact(EntityID id, const MoveResult& move) {
+    if (move.other == INVALID_ENTITY) return;
+
+    const std::pair<EntityID, EntityID> contact{ id, move.other };
+    if (m_contacts.empty() || m_contacts.back() != contact) m_contacts.push_back(contact);
+}
+
+void CharacterControllerSystem::SetSpatialQuery(const SpatialQuery* spatialQuery) { m_spatialQuery = spatialQuery; }
+void CharacterControllerSystem::SetTileMap(const TileCollisionMap* tileMap) { m_tileMap = tileMap; }
+const std::vector<std::pair<EntityID, EntityID>>& CharacterControllerSystem::GetContacts() const { return m_contacts; }
+const CharacterControllerStats& CharacterControllerSystem::GetStats() const { return m_stats; }
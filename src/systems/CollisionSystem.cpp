@@ -1,5 +1,7 @@
 #include "systems/CollisionSystem.h"
+#include <algorithm>
 #include <iostream>
+#include <unordered_set>
 
 CollisionSystem::CollisionSystem(EntityManager& entityManager,
                                  ComponentStorage<TransformComponent>& transforms,
@@ -9,96 +11,312 @@ CollisionSystem::CollisionSystem(EntityManager& entityManager,
           m_colliders{colliders} {}
 
 void CollisionSystem::Update(float deltaTime) {
-    const int cellSize = m_spatialGrid.GetCellSize();
     m_spatialGrid.Clear();
+    m_proxies.resize(m_staticCount);  // keep the sleeping part
     m_collisions.clear();
+    m_candidates.clear();
 
-    // Insert to grid
+    // Gather awake colliders
+    size_t sleeping = 0;
     for (EntityID id : m_entityManager.GetAllEntities()) {
-        if (!m_transforms.Has(id) || !m_colliders.Has(id)) continue;
-
-        const auto* t = m_transforms.Get(id);
         const auto* c = m_colliders.Get(id);
+        if (!c || IsTrigger(*c) || !m_transforms.Has(id)) continue;  // triggers: TriggerSystem
+        if (IsSleeping(id)) {
+            ++sleeping;
+            continue;
+        }
+        m_proxies.push_back(MakeProxy(id, *m_transforms.Get(id), *c));
+    }
+
+    // Sleeping set changed (or a sleeping entity was destroyed)
+    m_stats.staticRebuilt = m_staticDirty || sleeping != m_staticCount;
+    if (m_stats.staticRebuilt) {
+        RebuildStatic(sleeping);
+    }
 
-        const float x = t->position.x;
-        const float y = t->position.y;
-        const int w = c->width;
-        const int h = c->height;
+    // Order by layer bucket, so every cell list comes out grouped by bucket
+    std::stable_sort(m_proxies.begin() + m_staticCount, m_proxies.end(),
+                     [](const ColliderProxy& a, const ColliderProxy& b) { return a.bucket < b.bucket; });
 
-        const int startX = static_cast<int>(std::floor(x / cellSize));
-        const int endX   = static_cast<int>(std::floor((x + w) / cellSize));
-        const int startY = static_cast<int>(std::floor(y / cellSize));
-        const int endY   = static_cast<int>(std::floor((y + h) / cellSize));
+    m_layerMatrix = m_staticLayers;
+    for (size_t index = m_staticCount; index < m_proxies.size(); ++index) {
+        m_layerMatrix.Add(m_proxies[index].layer, m_proxies[index].mask);
+        InsertToGrid(m_spatialGrid, index);
+    }
+    m_layerMatrix.Build();
 
-        for (int cx = startX; cx <= endX; ++cx) {
-            for (int cy = startY; cy <= endY; ++cy) {
-                m_spatialGrid.Insert({cx, cy}, id);
-            }
-        }
+    // Awake vs awake and awake vs sleeping - sleeping pairs can't have changed
+    std::vector<BucketRun> runs;
+    std::vector<BucketRun> staticRuns;
+    for (const auto& [cell, proxies] : m_spatialGrid.GetAllCells()) {
+        BuildRuns(proxies, runs);
+        TestRuns(cell, proxies, runs, proxies, runs, true);
+
+        const auto& statics = m_staticGrid.Query(cell.x, cell.y);
+        if (statics.empty()) continue;
+
+        BuildRuns(statics, staticRuns);
+        TestRuns(cell, proxies, runs, statics, staticRuns, false);
     }
 
-    // Check collisions in all occupied cells
-    std::unordered_set<std::pair<EntityID, EntityID>, PairHash> checked;
-    for (const auto& [cell, entities] : m_spatialGrid.GetAllCells()) {
-        for (EntityID a : entities) {
-            for (EntityID b : entities) {
-                if (a == b) continue;
-                auto pair = (a < b) ? std::make_pair(a, b) : std::make_pair(b, a);
-                if (checked.count(pair)) continue;
-                checked.insert(pair);
-
-                CheckAndHandleCollision(a, b);
+    Narrowphase();
+
+    m_stats.colliders = m_proxies.size();
+    m_stats.staticColliders = m_staticCount;
+    m_stats.candidatePairs = m_candidates.size();
+    m_stats.collisions = m_collisions.size();
+}
+
+// Layer filter + batched AABB test of all candidate pairs, reading only the proxy array
+void CollisionSystem::Narrowphase() {
+    const size_t count = m_candidates.size();
+    const size_t chunks = m_jobSystem ? m_jobSystem->ChunkCount(count, NARROWPHASE_GRAIN) : 1;
+
+    if (m_chunkHits.size() < chunks) m_chunkHits.resize(chunks);
+    for (size_t chunk = 0; chunk < chunks; ++chunk) m_chunkHits[chunk].clear();
+
+    auto testRange = [this](size_t begin, size_t end, size_t chunk) {
+        auto& hits = m_chunkHits[chunk];
+        AABBLanes lanes;
+        uint32_t laneProxy[AABB_BATCH];
+
+        for (size_t i = begin; i < end;) {
+            // The broadphase emits all pairs of one proxy in a row - test them in batches
+            const uint32_t first = m_candidates[i].first;
+            const ColliderProxy& a = m_proxies[first];
+
+            lanes.count = 0;
+            for (; i < end && m_candidates[i].first == first && !lanes.Full(); ++i) {
+                const uint32_t second = m_candidates[i].second;
+                const ColliderProxy& b = m_proxies[second];
+                if (!HasAnyLayer(a.mask, b.layer) && !HasAnyLayer(b.mask, a.layer)) continue;
+
+                laneProxy[lanes.count] = second;
+                lanes.Push(b.bounds);
             }
-            auto neighbors = m_spatialGrid.QueryNeighbors(cell.x, cell.y);
-            for (EntityID b : neighbors) {
-                if (a == b) continue;
-                auto pair = (a < b) ? std::make_pair(a, b) : std::make_pair(b, a);
-                if (checked.count(pair)) continue;
-                checked.insert(pair);
-                CheckAndHandleCollision(a, b);
+            if (lanes.count == 0) continue;
+
+            const uint32_t mask = OverlapMask(a.bounds, lanes);
+            for (size_t lane = 0; lane < lanes.count; ++lane) {
+                if (mask & (1u << lane)) hits.push_back({ a.id, m_proxies[laneProxy[lane]].id });
             }
         }
+    };
+
+    if (m_jobSystem) {
+        m_jobSystem->ParallelFor(count, NARROWPHASE_GRAIN, testRange);
+    } else {
+        testRange(0, count, 0);
+    }
+
+    // Merge in chunk order - same result for any thread count
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        m_collisions.insert(m_collisions.end(), m_chunkHits[chunk].begin(), m_chunkHits[chunk].end());
     }
 }
 
+// Sleeping colliders go to the front of m_proxies and into their own grid
+void CollisionSystem::RebuildStatic(size_t staticCount) {
+    std::vector<ColliderProxy> statics;
+    statics.reserve(staticCount);
+    for (EntityID id : m_entityManager.GetAllEntities()) {
+        const auto* c = m_colliders.Get(id);
+        if (!c || IsTrigger(*c) || !m_transforms.Has(id) || !IsSleeping(id)) continue;
+        statics.push_back(MakeProxy(id, *m_transforms.Get(id), *c));
+    }
+    std::stable_sort(statics.begin(), statics.end(),
+                     [](const ColliderProxy& a, const ColliderProxy& b) { return a.bucket < b.bucket; });
+
+    m_proxies.erase(m_proxies.begin(), m_proxies.begin() + m_staticCount);
+    m_proxies.insert(m_proxies.begin(), statics.begin(), statics.end());
+    m_staticCount = statics.size();
+
+    m_staticGrid.Clear();
+    m_staticLayers.Clear();
+    for (size_t index = 0; index < m_staticCount; ++index) {
+        m_staticLayers.Add(m_proxies[index].layer, m_proxies[index].mask);
+        InsertToGrid(m_staticGrid, index);
+    }
+    m_staticDirty = false;
+}
 
-// Check collision between entities
-bool CollisionSystem::IsColliding(int ax, int ay, int aw, int ah,
-                                  int bx, int by, int bw, int bh) {
-    return !(ax + aw <= bx ||
-             ax >= bx + bw ||
-             ay + ah <= by ||
-             ay >= by + bh);
+ColliderProxy CollisionSystem::MakeProxy(EntityID id, const TransformComponent& t,
+                                         const ColliderComponent& c) const {
+    return { id,
+             AABB{ t.position.x, t.position.y, static_cast<float>(c.width), static_cast<float>(c.height) },
+             c.layer, c.mask,
+             static_cast<uint8_t>(LayerMatrix::BucketOf(c.layer)) };
 }
 
-// Handle collision and publish event
-void CollisionSystem::CheckAndHandleCollision(EntityID a, EntityID b) {
-    const auto* ta = m_transforms.Get(a);
-    const auto* tb = m_transforms.Get(b);
-    const auto* ca = m_colliders.Get(a);
-    const auto* cb = m_colliders.Get(b);
+void CollisionSystem::InsertToGrid(SpatialGrid<size_t>& grid, size_t index) {
+    const int cellSize = grid.GetCellSize();
+    const AABB& box = m_proxies[index].bounds;
 
-    if (!ta || !tb || !ca || !cb) return;
+    const int startX = static_cast<int>(std::floor(box.x / cellSize));
+    const int endX   = static_cast<int>(std::floor((box.x + box.w) / cellSize));
+    const int startY = static_cast<int>(std::floor(box.y / cellSize));
+    const int endY   = static_cast<int>(std::floor((box.y + box.h) / cellSize));
+
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            grid.Insert({cx, cy}, index);
+        }
+    }
+}
+
+bool CollisionSystem::IsSleeping(EntityID id) const {
+    if (!m_physics) return false;
+    const auto* phys = m_physics->Get(id);
+    return phys && phys->isSleeping;
+}
+
+// Split a bucket-sorted cell list into runs of one bucket
+void CollisionSystem::BuildRuns(const std::vector<size_t>& list, std::vector<BucketRun>& runs) const {
+    runs.clear();
+    for (size_t i = 0; i < list.size();) {
+        const uint8_t bucket = m_proxies[list[i]].bucket;
+        size_t end = i + 1;
+        while (end < list.size() && m_proxies[list[end]].bucket == bucket) ++end;
+        runs.push_back({ i, end, bucket });
+        i = end;
+    }
+}
 
-    // Skip if entities cannot collide
-    if (!CanCollide(*ca, *cb)) return;
+// Test pairs only between bucket runs that can interact
+void CollisionSystem::TestRuns(const Int2& cell,
+                               const std::vector<size_t>& listA, const std::vector<BucketRun>& runsA,
+                               const std::vector<size_t>& listB, const std::vector<BucketRun>& runsB,
+                               bool sameList) {
+    const int cellSize = m_spatialGrid.GetCellSize();
 
-    const float ax = ta->position.x;
-    const float ay = ta->position.y;
-    const int   aw = ca->width;
-    const int   ah = ca->height;
+    for (size_t r1 = 0; r1 < runsA.size(); ++r1) {
+        for (size_t r2 = sameList ? r1 : 0; r2 < runsB.size(); ++r2) {
+            if (!m_layerMatrix.Interacts(runsA[r1].bucket, runsB[r2].bucket)) continue;
 
-    const float bx = tb->position.x;
-    const float by = tb->position.y;
-    const int   bw = cb->width;
-    const int   bh = cb->height;
+            for (size_t i = runsA[r1].begin; i < runsA[r1].end; ++i) {
+                const size_t jStart = (sameList && r1 == r2) ? i + 1 : runsB[r2].begin;
+                for (size_t j = jStart; j < runsB[r2].end; ++j) {
+                    const ColliderProxy& a = m_proxies[listA[i]];
+                    const ColliderProxy& b = m_proxies[listB[j]];
+                    if (!IsOwnerCell(cell, a.bounds, b.bounds, cellSize)) continue;
 
-    if (IsColliding(ax, ay, aw, ah, bx, by, bw, bh)) {
-        m_collisions.push_back( {a, b} );
+                    m_candidates.push_back({ static_cast<uint32_t>(listA[i]),
+                                             static_cast<uint32_t>(listB[j]) });
+                }
+            }
+        }
     }
 }
 
+// A pair is handled only in the cell holding the top-left corner of the two boxes' overlap.
+// Both boxes are inserted there, so every pair is tested exactly once without a "checked" set.
+bool CollisionSystem::IsOwnerCell(const Int2& cell, const AABB& a, const AABB& b, int cellSize) {
+    const float x = std::max(a.x, b.x);
+    const float y = std::max(a.y, b.y);
+    return static_cast<int>(std::floor(x / cellSize)) == cell.x &&
+           static_cast<int>(std::floor(y / cellSize)) == cell.y;
+}
+
+
 // Get all collisions
 const std::vector<std::pair<EntityID, EntityID>>& CollisionSystem::GetCollisions() const {
     return m_collisions;
 }
+
+const CollisionStats& CollisionSystem::GetStats() const {
+    return m_stats;
+}
+
+// Swept test against entities in the grid cells covered by the whole motion
+bool CollisionSystem::Sweep(EntityID id, const VectorFloat& delta, SweepHit& hit) {
+    const auto* t = m_transforms.Get(id);
+    const auto* c = m_colliders.Get(id);
+    if (!t || !c || !c->continuous) return false;
+
+    // Under this speed a body can't pass through anything in one frame
+    if (std::abs(delta.x) < c->width * 0.5f && std::abs(delta.y) < c->height * 0.5f) return false;
+
+    const AABB moving{ t->position.x, t->position.y,
+                       static_cast<float>(c->width), static_cast<float>(c->height) };
+
+    // Swept bounds
+    const float minX = std::min(moving.x, moving.x + delta.x);
+    const float minY = std::min(moving.y, moving.y + delta.y);
+    const float maxX = std::max(moving.x, moving.x + delta.x) + moving.w;
+    const float maxY = std::max(moving.y, moving.y + delta.y) + moving.h;
+
+    const int cellSize = m_spatialGrid.GetCellSize();
+    const int startX = static_cast<int>(std::floor(minX / cellSize));
+    const int endX   = static_cast<int>(std::floor(maxX / cellSize));
+    const int startY = static_cast<int>(std::floor(minY / cellSize));
+    const int endY   = static_cast<int>(std::floor(maxY / cellSize));
+
+    std::unordered_set<size_t> tested;
+    bool found = false;
+    hit.toi = 1.0f;
+
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            ForEachInCell(cx, cy, [&](size_t index) {
+                const ColliderProxy& other = m_proxies[index];
+                if (other.id == id || !tested.insert(index).second) return;
+                if (!HasAnyLayer(c->mask, other.layer) && !HasAnyLayer(other.mask, c->layer)) return;
+
+                // The grid is from the last Update - test where the candidate is now
+                AABB bounds = other.bounds;
+                if (const auto* ot = m_transforms.Get(other.id)) {
+                    bounds.x = ot->position.x;
+                    bounds.y = ot->position.y;
+                }
+
+                float toi;
+                VectorFloat normal;
+                if (SweepAABB(moving, delta, bounds, toi, normal) && toi < hit.toi) {
+                    hit.entity = other.id;
+                    hit.toi = toi;
+                    hit.normal = normal;
+                    found = true;
+                }
+            });
+        }
+    }
+    return found;
+}
+
+void CollisionSystem::ReportContact(EntityID a, EntityID b) {
+    m_sweptContacts.push_back( {a, b} );
+}
+
+const std::vector<std::pair<EntityID, EntityID>>& CollisionSystem::GetSweptContacts() const {
+    return m_sweptContacts;
+}
+
+void CollisionSystem::ClearSweptContacts() {
+    m_sweptContacts.clear();
+}
+
+// Broadphase snapshot
+const std::vector<ColliderProxy>& CollisionSystem::GetProxies() const {
+    return m_proxies;
+}
+
+const SpatialGrid<size_t>& CollisionSystem::GetGrid() const {
+    return m_spatialGrid;
+}
+
+const SpatialGrid<size_t>& CollisionSystem::GetStaticGrid() const {
+    return m_staticGrid;
+}
+
+void CollisionSystem::SetPhysics(const ComponentStorage<PhysicsComponent>* physics) {
+    m_physics = physics;
+    m_staticDirty = true;
+}
+
+void CollisionSystem::InvalidateStaticBodies() {
+    m_staticDirty = true;
+}
+
+void CollisionSystem::SetJobSystem(JobSystem* jobSystem) {
+    m_jobSystem = jobSystem;
+}
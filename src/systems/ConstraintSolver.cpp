@@ -0,0 +1,456 @@
+#include "systems/ConstraintSolver.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float STATIC_FRICTION_SPEED = 1.0f;  // px/s, slower sliding sticks
+    constexpr float GROUND_NORMAL = 0.7f;          // |normal.y| of a floor contact
+    constexpr float SAME_NORMAL = 0.9f;            // cached impulses are dropped when the normal flips
+    constexpr float JOINT_MIN_LENGTH = 0.001f;     // px, below that a distance joint has no direction
+
+    VectorFloat Tangent(const VectorFloat& normal) {
+        return { -normal.y, normal.x };
+    }
+
+    float MixFriction(const PhysicsComponent* a, const PhysicsComponent* b, float PhysicsComponent::*coefficient) {
+        if (!a) return b->*coefficient;
+        if (!b) return a->*coefficient;
+        return std::sqrt(a->*coefficient * b->*coefficient);
+    }
+}
+
+ConstraintSolver::ConstraintSolver(ComponentStorage<TransformComponent>& transforms,
+                                   ComponentStorage<ColliderComponent>& colliders,
+                                   ComponentStorage<PhysicsComponent>& physics)
+    : m_transforms{transforms}, m_colliders{colliders}, m_physics{physics} {}
+
+void ConstraintSolver::Solve(const std::vector<std::pair<EntityID, EntityID>>& pairs, float deltaTime) {
+    Run(pairs, deltaTime, true);
+}
+
+void ConstraintSolver::SolveSubstep(const std::vector<std::pair<EntityID, EntityID>>& pairs, float deltaTime) {
+    Run(pairs, deltaTime, false);
+}
+
+void ConstraintSolver::Run(const std::vector<std::pair<EntityID, EntityID>>& pairs, float deltaTime,
+                           bool withJoints) {
+    m_bodies.clear();
+    m_bodyIndex.clear();
+    m_contacts.clear();
+    m_joints.clear();
+    m_stats = {};
+    if (deltaTime <= 0.0f) return;
+
+    for (const auto& [a, b] : pairs) {
+        Contact contact;
+        if (MakeContact(a, b, deltaTime, contact)) m_contacts.push_back(contact);
+    }
+
+    // Same contact order every run regardless of the broadphase order
+    std::sort(m_contacts.begin(), m_contacts.end(),
+              [](const Contact& x, const Contact& y) { return x.key < y.key; });
+
+    // Joints sorted by the bodies they connect, so neighbouring constraints touch neighbouring bodies
+    if (m_jointStorage && withJoints) {
+        m_jointSources.clear();
+        for (auto& [owner, source] : m_jointStorage->GetAll()) {
+            m_jointSources.push_back({ owner, &source });
+        }
+        std::sort(m_jointSources.begin(), m_jointSources.end(), [](const auto& x, const auto& y) {
+            const auto kx = std::minmax(x.first, x.second->other);
+            const auto ky = std::minmax(y.first, y.second->other);
+            return kx < ky;
+        });
+        for (auto& [owner, source] : m_jointSources) {
+            Joint joint;
+            if (MakeJoint(owner, *source, deltaTime, joint)) m_joints.push_back(joint);
+        }
+    }
+
+    // Warm start
+    if (m_warmStarting) {
+        for (Contact& contact : m_contacts) {
+            auto it = m_cache.find(contact.key);
+            if (it == m_cache.end() || it->second.normal.Dot(contact.normal) < SAME_NORMAL) continue;
+
+            contact.normalImpulse = it->second.normalImpulse;
+            contact.tangentImpulse = it->second.tangentImpulse;
+            ApplyImpulse(contact.a, contact.b, contact.normal * contact.normalImpulse +
+                                               Tangent(contact.normal) * contact.tangentImpulse);
+            ++m_stats.warmStarted;
+        }
+        for (Joint& joint : m_joints) {
+            ApplyImpulse(joint.a, joint.b, joint.type == JointType::Pin ? joint.impulse : joint.normal * joint.impulse.x);
+        }
+    } else {
+        for (Joint& joint : m_joints) joint.impulse = {0.0f, 0.0f};
+    }
+
+    if (m_islandSolving) {
+        BuildIslands();
+        SolveIslands();
+    } else {
+        SolveAll();
+    }
+
+    // Results (a substep only refreshes its own pairs)
+    if (withJoints) m_cache.clear();
+    for (const Contact& contact : m_contacts) {
+        m_cache[contact.key] = { contact.normal, contact.normalImpulse, contact.tangentImpulse };
+    }
+    for (const Joint& joint : m_joints) {
+        joint.source->impulse = joint.impulse;
+    }
+    for (SolverBody& body : m_bodies) {
+        if (body.invMass > 0.0f) body.phys->velocity = body.velocity;
+    }
+
+    m_stats.bodies = m_bodies.size();
+    m_stats.contacts = m_contacts.size();
+    m_stats.joints = m_joints.size();
+}
+
+// All constraints every iteration, colour by colour when graph colouring is on
+void ConstraintSolver::SolveAll() {
+    if (m_coloring) {
+        m_bodyColors.assign(m_bodies.size(), 0);
+        Color(m_contacts, m_contactColors);
+        m_bodyColors.assign(m_bodies.size(), 0);
+        Color(m_joints, m_jointColors);
+        m_stats.colors = std::max(m_contactColors.size(), m_jointColors.size()) - 1;
+    }
+
+    for (int iteration = 0; iteration < m_iterations; ++iteration) {
+        SolveBatches(m_contacts, m_contactColors, [this](Contact& contact) { SolveContact(contact); });
+        SolveBatches(m_joints, m_jointColors, [this](Joint& joint) { SolveJoint(joint); });
+    }
+}
+
+// AABB manifold: normal along the axis of least penetration, from a to b
+bool ConstraintSolver::MakeContact(EntityID a, EntityID b, float deltaTime, Contact& contact) {
+    const auto* ta = m_transforms.Get(a);
+    const auto* tb = m_transforms.Get(b);
+    const auto* ca = m_colliders.Get(a);
+    const auto* cb = m_colliders.Get(b);
+    if (!ta || !tb || !ca || !cb) return false;
+
+    const float overlapX = std::min(ta->position.x + ca->width, tb->position.x + cb->width) -
+                           std::max(ta->position.x, tb->position.x);
+    const float overlapY = std::min(ta->position.y + ca->height, tb->position.y + cb->height) -
+                           std::max(ta->position.y, tb->position.y);
+    if (overlapX <= 0.0f || overlapY <= 0.0f) return false;
+
+    const float dx = (tb->position.x + cb->width * 0.5f) - (ta->position.x + ca->width * 0.5f);
+    const float dy = (tb->position.y + cb->height * 0.5f) - (ta->position.y + ca->height * 0.5f);
+
+    if (overlapX < overlapY) {
+        contact.normal = { dx < 0.0f ? -1.0f : 1.0f, 0.0f };
+        contact.penetration = overlapX;
+    } else {
+        contact.normal = { 0.0f, dy < 0.0f ? -1.0f : 1.0f };
+        contact.penetration = overlapY;
+    }
+
+    // Bodies are added only for real contacts
+    const auto* pa = m_physics.Get(a);
+    const auto* pb = m_physics.Get(b);
+    const bool dynamicA = pa && !pa->isSleeping && pa->invMass > 0.0f;
+    const bool dynamicB = pb && !pb->isSleeping && pb->invMass > 0.0f;
+    if (!dynamicA && !dynamicB) return false;
+
+    contact.a = AddBody(a);
+    contact.b = AddBody(b);
+
+    // Key in id order, normal stored from key.first to key.second
+    if (a > b) {
+        std::swap(contact.a, contact.b);
+        contact.normal = -contact.normal;
+    }
+    contact.key = { std::min(a, b), std::max(a, b) };
+
+    const SolverBody& bodyA = m_bodies[contact.a];
+    const SolverBody& bodyB = m_bodies[contact.b];
+    contact.normalMass = 1.0f / (bodyA.invMass + bodyB.invMass);
+    contact.bias = m_beta / deltaTime * std::max(0.0f, contact.penetration - m_slop);
+    contact.normalImpulse = 0.0f;
+    contact.tangentImpulse = 0.0f;
+    contact.color = 0;
+
+    const float slide = std::abs((bodyB.velocity - bodyA.velocity).Dot(Tangent(contact.normal)));
+    contact.friction = slide < STATIC_FRICTION_SPEED
+        ? MixFriction(bodyA.phys, bodyB.phys, &PhysicsComponent::frictionStatic)
+        : MixFriction(bodyA.phys, bodyB.phys, &PhysicsComponent::frictionKinetic);
+    if (!bodyA.phys && !bodyB.phys) contact.friction = 0.0f;
+
+    // Screen space: y grows downwards, so the body above has the normal pointing up at it
+    if (contact.normal.y < -GROUND_NORMAL) m_bodies[contact.b].grounded = true;
+    if (contact.normal.y > GROUND_NORMAL) m_bodies[contact.a].grounded = true;
+    return true;
+}
+
+uint32_t ConstraintSolver::AddBody(EntityID id) {
+    auto [it, inserted] = m_bodyIndex.emplace(id, static_cast<uint32_t>(m_bodies.size()));
+    if (!inserted) return it->second;
+
+    PhysicsComponent* phys = m_physics.Get(id);
+    const bool dynamic = phys && !phys->isSleeping && phys->invMass > 0.0f;
+    m_bodies.push_back({ id, phys,
+                         dynamic ? phys->velocity : VectorFloat{0.0f, 0.0f},
+                         dynamic ? phys->invMass : 0.0f,
+                         false });
+    return it->second;
+}
+
+// Joint between the anchors; rigid joints correct drift like contacts, springs are soft
+bool ConstraintSolver::MakeJoint(EntityID owner, JointComponent& source, float deltaTime, Joint& joint) {
+    const auto* ta = m_transforms.Get(owner);
+    const auto* tb = m_transforms.Get(source.other);
+    if (!ta || !tb || owner == source.other) return false;
+
+    const auto* pa = m_physics.Get(owner);
+    const auto* pb = m_physics.Get(source.other);
+    const bool dynamicA = pa && !pa->isSleeping && pa->invMass > 0.0f;
+    const bool dynamicB = pb && !pb->isSleeping && pb->invMass > 0.0f;
+    if (!dynamicA && !dynamicB) return false;
+
+    const VectorFloat d = (tb->position + source.anchorB) - (ta->position + source.anchorA);
+    const float length = d.Length();
+
+    joint.type = source.type;
+    joint.source = &source;
+    joint.gamma = 0.0f;
+    joint.color = 0;
+    joint.impulse = source.impulse;
+
+    if (joint.type == JointType::Pin) {
+        joint.normal = {0.0f, 0.0f};
+        joint.bias = d * (m_beta / deltaTime);
+    } else {
+        if (length < JOINT_MIN_LENGTH) return false;  // direction undefined
+
+        const float stretch = length - source.length;
+        if (joint.type == JointType::Rope && stretch <= 0.0f) {
+            source.impulse = {0.0f, 0.0f};  // slack
+            return false;
+        }
+
+        joint.normal = d * (1.0f / length);
+        joint.bias = { stretch * (m_beta / deltaTime), 0.0f };
+        joint.impulse.y = 0.0f;
+
+        // Soft constraint (Box2D style): gamma softens the mass, the bias pulls towards the rest length
+        if (joint.type == JointType::Spring) {
+            const float soft = deltaTime * (source.damping + deltaTime * source.stiffness);
+            joint.gamma = soft > 0.0f ? 1.0f / soft : 0.0f;
+            joint.bias.x = stretch * deltaTime * source.stiffness * joint.gamma;
+        }
+    }
+
+    joint.a = AddBody(owner);
+    joint.b = AddBody(source.other);
+    joint.mass = 1.0f / (m_bodies[joint.a].invMass + m_bodies[joint.b].invMass + joint.gamma);
+    return true;
+}
+
+// Static bodies are never written (colours only keep dynamic bodies apart)
+void ConstraintSolver::ApplyImpulse(uint32_t a, uint32_t b, const VectorFloat& impulse) {
+    SolverBody& bodyA = m_bodies[a];
+    SolverBody& bodyB = m_bodies[b];
+    if (bodyA.invMass > 0.0f) bodyA.velocity = bodyA.velocity - impulse * bodyA.invMass;
+    if (bodyB.invMass > 0.0f) bodyB.velocity = bodyB.velocity + impulse * bodyB.invMass;
+}
+
+void ConstraintSolver::SolveContact(Contact& contact) {
+    const VectorFloat tangent = Tangent(contact.normal);
+
+    // Friction, bounded by the current normal impulse
+    {
+        const SolverBody& a = m_bodies[contact.a];
+        const SolverBody& b = m_bodies[contact.b];
+        const float vt = (b.velocity - a.velocity).Dot(tangent);
+        const float limit = contact.friction * contact.normalImpulse;
+
+        const float previous = contact.tangentImpulse;
+        contact.tangentImpulse = std::clamp(previous - vt * contact.normalMass, -limit, limit);
+        ApplyImpulse(contact.a, contact.b, tangent * (contact.tangentImpulse - previous));
+    }
+
+    // Non-penetration, pushes apart only
+    {
+        const SolverBody& a = m_bodies[contact.a];
+        const SolverBody& b = m_bodies[contact.b];
+        const float vn = (b.velocity - a.velocity).Dot(contact.normal);
+
+        const float previous = contact.normalImpulse;
+        contact.normalImpulse = std::max(0.0f, previous + (contact.bias - vn) * contact.normalMass);
+        ApplyImpulse(contact.a, contact.b, contact.normal * (contact.normalImpulse - previous));
+    }
+}
+
+void ConstraintSolver::SolveJoint(Joint& joint) {
+    const VectorFloat relative = m_bodies[joint.b].velocity - m_bodies[joint.a].velocity;
+
+    if (joint.type == JointType::Pin) {
+        const VectorFloat lambda = (relative + joint.bias) * -joint.mass;
+        joint.impulse = joint.impulse + lambda;
+        ApplyImpulse(joint.a, joint.b, lambda);
+        return;
+    }
+
+    const float vn = relative.Dot(joint.normal);
+    const float previous = joint.impulse.x;
+    joint.impulse.x = previous - joint.mass * (vn + joint.bias.x + joint.gamma * previous);
+    if (joint.type == JointType::Rope) joint.impulse.x = std::min(0.0f, joint.impulse.x);  // pulls only
+
+    ApplyImpulse(joint.a, joint.b, joint.normal * (joint.impulse.x - previous));
+}
+
+// Greedy colouring: first colour not used by either dynamic body, then constraints grouped by colour
+template<typename Constraint>
+void ConstraintSolver::Color(std::vector<Constraint>& constraints, std::vector<size_t>& offsets) {
+    for (Constraint& constraint : constraints) {
+        const bool dynamicA = m_bodies[constraint.a].invMass > 0.0f;
+        const bool dynamicB = m_bodies[constraint.b].invMass > 0.0f;
+        const uint64_t used = (dynamicA ? m_bodyColors[constraint.a] : 0) | (dynamicB ? m_bodyColors[constraint.b] : 0);
+
+        uint8_t color = 0;
+        while (color < SERIAL_COLOR && (used >> color) & 1u) ++color;
+
+        constraint.color = color;
+        if (color == SERIAL_COLOR) continue;
+        if (dynamicA) m_bodyColors[constraint.a] |= uint64_t{1} << color;
+        if (dynamicB) m_bodyColors[constraint.b] |= uint64_t{1} << color;
+    }
+
+    std::stable_sort(constraints.begin(), constraints.end(),
+                     [](const Constraint& x, const Constraint& y) { return x.color < y.color; });
+
+    offsets.assign(1, 0);
+    for (size_t i = 1; i <= constraints.size(); ++i) {
+        if (i == constraints.size() || constraints[i].color != constraints[i - 1].color) offsets.push_back(i);
+    }
+}
+
+template<typename Constraint, typename SolveFn>
+void ConstraintSolver::SolveBatches(std::vector<Constraint>& constraints, const std::vector<size_t>& offsets,
+                                    SolveFn solve) {
+    if (!m_coloring) {
+        for (Constraint& constraint : constraints) solve(constraint);
+        return;
+    }
+
+    for (size_t batch = 0; batch + 1 < offsets.size(); ++batch) {
+        const size_t begin = offsets[batch];
+        const size_t end = offsets[batch + 1];
+
+        // Overflow colour shares bodies - keep it on this thread
+        if (!m_jobSystem || constraints[begin].color == SERIAL_COLOR) {
+            for (size_t i = begin; i < end; ++i) solve(constraints[i]);
+            continue;
+        }
+
+        m_jobSystem->ParallelFor(end - begin, SOLVER_GRAIN, [&](size_t first, size_t last, size_t) {
+            for (size_t i = begin + first; i < begin + last; ++i) solve(constraints[i]);
+        });
+    }
+}
+
+// Union-find over the dynamic bodies of every constraint, then constraints grouped by island
+void ConstraintSolver::BuildIslands() {
+    m_islandSets.Reset(m_bodies.size());
+    for (const Contact& contact : m_contacts) {
+        if (m_bodies[contact.a].invMass > 0.0f && m_bodies[contact.b].invMass > 0.0f) {
+            m_islandSets.Union(contact.a, contact.b);
+        }
+    }
+    for (const Joint& joint : m_joints) {
+        if (m_bodies[joint.a].invMass > 0.0f && m_bodies[joint.b].invMass > 0.0f) {
+            m_islandSets.Union(joint.a, joint.b);
+        }
+    }
+
+    // Island indices in order of the first contact / joint, so they don't depend on the union order
+    m_islandOf.assign(m_bodies.size(), UINT32_MAX);
+    uint32_t islands = 0;
+    for (const Contact& contact : m_contacts) {
+        uint32_t& island = m_islandOf[IslandRoot(contact)];
+        if (island == UINT32_MAX) island = islands++;
+    }
+    for (const Joint& joint : m_joints) {
+        uint32_t& island = m_islandOf[IslandRoot(joint)];
+        if (island == UINT32_MAX) island = islands++;
+    }
+
+    m_stats.islands = islands;
+    GroupByIsland(m_contacts, m_contactIslands);
+    GroupByIsland(m_joints, m_jointIslands);
+}
+
+// One job per island: every iteration of its contacts, then its joints - the serial order restricted to the island
+void ConstraintSolver::SolveIslands() {
+    const auto solveRange = [this](size_t first, size_t last, size_t) {
+        for (size_t island = first; island < last; ++island) {
+            for (int iteration = 0; iteration < m_iterations; ++iteration) {
+                for (size_t i = m_contactIslands[island]; i < m_contactIslands[island + 1]; ++i) {
+                    SolveContact(m_contacts[i]);
+                }
+                for (size_t i = m_jointIslands[island]; i < m_jointIslands[island + 1]; ++i) {
+                    SolveJoint(m_joints[i]);
+                }
+            }
+        }
+    };
+
+    if (m_jobSystem) {
+        m_jobSystem->ParallelFor(m_stats.islands, ISLAND_GRAIN, solveRange);
+    } else {
+        solveRange(0, m_stats.islands, 0);
+    }
+}
+
+// Constraints only link islands through dynamic bodies, at least one side is dynamic
+template<typename Constraint>
+size_t ConstraintSolver::IslandRoot(const Constraint& constraint) {
+    return m_islandSets.Find(m_bodies[constraint.a].invMass > 0.0f ? constraint.a : constraint.b);
+}
+
+// Stable, so every island keeps the sorted constraint order; offsets has one entry per island + 1
+template<typename Constraint>
+void ConstraintSolver::GroupByIsland(std::vector<Constraint>& constraints, std::vector<size_t>& offsets) {
+    const size_t islands = m_stats.islands;
+    offsets.assign(islands + 1, 0);
+    for (const Constraint& constraint : constraints) {
+        ++offsets[m_islandOf[IslandRoot(constraint)] + 1];
+    }
+    for (size_t i = 1; i <= islands; ++i) offsets[i] += offsets[i - 1];
+
+    std::stable_sort(constraints.begin(), constraints.end(), [this](const Constraint& x, const Constraint& y) {
+        return m_islandOf[IslandRoot(x)] < m_islandOf[IslandRoot(y)];
+    });
+}
+
+void ConstraintSolver::SetIterations(int iterations) { m_iterations = std::max(1, iterations); }
+void ConstraintSolver::SetBaumgarte(float beta, float slop) {
+    m_beta = beta;
+    m_slop = slop;
+}
+void ConstraintSolver::SetWarmStarting(bool enabled) {
+    m_warmStarting = enabled;
+    if (!enabled) m_cache.clear();
+}
+void ConstraintSolver::SetJoints(ComponentStorage<JointComponent>* joints) { m_jointStorage = joints; }
+void ConstraintSolver::SetGraphColoring(bool enabled) {
+    m_coloring = enabled;
+    m_contactColors.clear();
+    m_jointColors.clear();
+}
+void ConstraintSolver::SetJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+void ConstraintSolver::SetIslandSolving(bool enabled) { m_islandSolving = enabled; }
+
+bool ConstraintSolver::IsGrounded(EntityID id) const {
+    auto it = m_bodyIndex.find(id);
+    return it != m_bodyIndex.end() && m_bodies[it->second].grounded;
+}
+
+const SolverStats& ConstraintSolver::GetStats() const { return m_stats; }
@@ -0,0 +1,184 @@
+#include "systems/ForceFields.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    bool Contains(const AABB& box, const VectorFloat& p) {
+        return p.x >= box.x && p.x < box.x + box.w &&
+               p.y >= box.y && p.y < box.y + box.h;
+    }
+
+    bool SameField(const ForceFieldComponent& a, const ForceFieldComponent& b) {
+        return a.type == b.type && a.width == b.width && a.height == b.height &&
+               a.direction.x == b.direction.x && a.direction.y == b.direction.y &&
+               a.strength == b.strength && a.falloff == b.falloff;
+    }
+}
+
+ForceFields::ForceFields(ComponentStorage<TransformComponent>& transforms,
+                         ComponentStorage<ForceFieldComponent>& fields)
+    : m_transforms{transforms}, m_fields{fields} {}
+
+void ForceFields::Apply(BodyLanes& lanes, const std::vector<VectorFloat>& points, size_t begin, size_t end,
+                        float deltaTime) {
+    Refresh();
+
+    m_stats.bodiesInside = 0;
+    m_stats.evaluations = 0;
+    if (m_volumes.empty()) return;
+
+    const int cellSize = m_grid.GetCellSize();
+    for (size_t i = begin; i < end; ++i) {
+        const VectorFloat& p = points[i];
+        if (!Contains(m_extent, p)) continue;
+
+        const auto& cell = m_grid.Query(static_cast<int>(std::floor(p.x / cellSize)),
+                                        static_cast<int>(std::floor(p.y / cellSize)));
+        if (cell.empty()) continue;
+
+        const VectorFloat velocity{ lanes.vx[i], lanes.vy[i] };
+        VectorFloat accel;
+        bool inside = false;
+        for (size_t index : cell) {
+            const Field& volume = m_volumes[index];
+            if (!Contains(volume.bounds, p)) continue;
+
+            accel = accel + Evaluate(volume, p, velocity, deltaTime);
+            inside = true;
+            ++m_stats.evaluations;
+        }
+        if (!inside) continue;
+
+        lanes.ax[i] += accel.x;
+        lanes.ay[i] += accel.y;
+        ++m_stats.bodiesInside;
+    }
+}
+
+VectorFloat ForceFields::Sample(const VectorFloat& point, const VectorFloat& velocity, float deltaTime) {
+    Refresh();
+    if (!Contains(m_extent, point)) return {};
+
+    const int cellSize = m_grid.GetCellSize();
+    VectorFloat accel;
+    for (size_t index : m_grid.Query(static_cast<int>(std::floor(point.x / cellSize)),
+                                     static_cast<int>(std::floor(point.y / cellSize)))) {
+        const Field& volume = m_volumes[index];
+        if (Contains(volume.bounds, point)) accel = accel + Evaluate(volume, point, velocity, deltaTime);
+    }
+    return accel;
+}
+
+VectorFloat ForceFields::Evaluate(const Field& volume, const VectorFloat& point, const VectorFloat& velocity,
+                                  float deltaTime) const {
+    const ForceFieldComponent& field = volume.field;
+
+    switch (field.type) {
+        case ForceFieldType::Uniform:
+            return field.direction;
+
+        case ForceFieldType::Drag: {
+            // Never more than the whole velocity difference in one step
+            const float rate = deltaTime > 0.0f ? std::min(field.strength, 1.0f / deltaTime) : field.strength;
+            return (field.direction - velocity) * rate;
+        }
+
+        case ForceFieldType::Radial:
+        case ForceFieldType::Vortex: {
+            const VectorFloat center{ volume.bounds.x + volume.bounds.w * 0.5f,
+                                      volume.bounds.y + volume.bounds.h * 0.5f };
+            const VectorFloat offset = point - center;
+            const float distance = offset.Length();
+            if (distance <= 0.0f) return {};
+
+            float strength = field.strength;
+            if (field.falloff) {
+                const float radius = std::min(volume.bounds.w, volume.bounds.h) * 0.5f;
+                strength *= std::max(0.0f, 1.0f - distance / radius);
+            }
+
+            const VectorFloat dir = offset * (1.0f / distance);
+            // Screen y points down: (-y, x) turns clockwise on screen
+            return field.type == ForceFieldType::Radial ? dir * strength
+                                                        : VectorFloat{ -dir.y, dir.x } * strength;
+        }
+    }
+    return {};
+}
+
+// Added / removed components bump the versions; moved or edited fields are found by comparison
+void ForceFields::Refresh() {
+    if (m_dirty ||
+        m_fields.GetVersion() != m_fieldVersion ||
+        m_transforms.GetVersion() != m_transformVersion ||
+        FieldsChanged()) {
+        Rebuild();
+    }
+}
+
+// Fields are few - compare each one with its copy in the grid
+bool ForceFields::FieldsChanged() const {
+    for (const Field& volume : m_volumes) {
+        const auto* t = m_transforms.Get(volume.id);
+        const auto* field = m_fields.Get(volume.id);
+        if (!t || !field) return true;
+
+        if (t->position.x != volume.bounds.x || t->position.y != volume.bounds.y ||
+            !SameField(*field, volume.field)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Rescan all fields into the grid, in id order so overlapping fields always sum the same way
+void ForceFields::Rebuild() {
+    m_grid.Clear();
+    m_volumes.clear();
+
+    std::vector<EntityID> ids;
+    for (const auto& [id, field] : m_fields.GetAll()) {
+        if (m_transforms.Get(id) && field.width > 0.0f && field.height > 0.0f) ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end());
+
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+    const int cellSize = m_grid.GetCellSize();
+    for (EntityID id : ids) {
+        const auto* t = m_transforms.Get(id);
+        const auto* field = m_fields.Get(id);
+        const AABB box{ t->position.x, t->position.y, field->width, field->height };
+
+        if (m_volumes.empty()) {
+            minX = box.x;          minY = box.y;
+            maxX = box.x + box.w;  maxY = box.y + box.h;
+        } else {
+            minX = std::min(minX, box.x);          minY = std::min(minY, box.y);
+            maxX = std::max(maxX, box.x + box.w);  maxY = std::max(maxY, box.y + box.h);
+        }
+
+        const size_t index = m_volumes.size();
+        m_volumes.push_back({ id, box, *field });
+
+        const int startX = static_cast<int>(std::floor(box.x / cellSize));
+        const int endX   = static_cast<int>(std::floor((box.x + box.w) / cellSize));
+        const int startY = static_cast<int>(std::floor(box.y / cellSize));
+        const int endY   = static_cast<int>(std::floor((box.y + box.h) / cellSize));
+
+        for (int cx = startX; cx <= endX; ++cx) {
+            for (int cy = startY; cy <= endY; ++cy) {
+                m_grid.Insert({cx, cy}, index);
+            }
+        }
+    }
+
+    m_extent = { minX, minY, maxX - minX, maxY - minY };
+    m_stats.fields = m_volumes.size();
+    m_fieldVersion = m_fields.GetVersion();
+    m_transformVersion = m_transforms.GetVersion();
+    m_dirty = false;
+}
+
+void ForceFields::InvalidateFields() { m_dirty = true; }
+const ForceFieldStats& ForceFields::GetStats() const { return m_stats; }
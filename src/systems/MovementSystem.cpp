@@ -1,31 +1,26 @@
 #include "systems/MovementSystem.h"
-#include <iostream>
+#include "utils/Real.h"
 
 MovementSystem::MovementSystem(ComponentStorage<TransformComponent>& transforms,
                                ComponentStorage<VelocityComponent>& velocities,
                                ComponentStorage<AccelerationComponent>& accelerations,
                                ComponentStorage<PhysicsComponent>& physics)
     : m_transforms{transforms}, m_velocities(velocities), 
-      m_accelerations(accelerations), m_physics{physics} {}
+      m_accelerations(accelerations), m_physics{physics},
+      m_sets{transforms, accelerations, physics, &velocities} {}
 
 // Update state
 void MovementSystem::Update(float deltaTime) {
-    for (auto& [id, velocity] : m_velocities.GetAll()) {
-        if (m_physics.Has(id)) continue;
-        
-        // Get key info from components
-        auto* transform = m_transforms.Get(id);
-        auto* acceleration = m_accelerations.Get(id);
-        
-        // Check conditions and set values
-        if (acceleration) {
-            velocity.dx += acceleration->ax * deltaTime;
-            velocity.dy += acceleration->ay * deltaTime;
-        }
+    m_sets.Refresh();
 
-        if (transform) {
-            transform->position.x += velocity.dx * deltaTime;
-            transform->position.y += velocity.dy * deltaTime;
-        }
+    // Every kinematic body has a transform and an acceleration (zero if it has none)
+    for (const KinematicBody& body : m_sets.GetKinematic()) {
+        VelocityComponent& velocity = *body.velocity;
+        velocity.dx = RealMulAdd(velocity.dx, body.acceleration->ax, deltaTime);
+        velocity.dy = RealMulAdd(velocity.dy, body.acceleration->ay, deltaTime);
+
+        VectorFloat& position = body.transform->position;
+        position.x = RealMulAdd(position.x, velocity.dx, deltaTime);
+        position.y = RealMulAdd(position.y, velocity.dy, deltaTime);
     }
 }
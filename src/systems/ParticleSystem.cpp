@@ -0,0 +1,213 @@
+#include "systems/ParticleSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace {
+    constexpr float DEG_TO_RAD = 3.14159265f / 180.0f;
+
+    uint32_t PackColor(const SDL_Color& c) {
+        return (static_cast<uint32_t>(c.r) << 16) | (static_cast<uint32_t>(c.g) << 8) | c.b;
+    }
+}
+
+ParticleSystem::ParticleSystem(unsigned int seed)
+    : m_rng{seed} {}
+
+void ParticleSystem::Update(float deltaTime) {
+    m_stats.emitters = 0;
+    m_stats.particles = 0;
+
+    for (Emitter& emitter : m_emitters) {
+        if (!emitter.alive) continue;
+        const ParticleEmitterConfig& config = emitter.config;
+
+        // Steady emission, fractions carried over so low rates still spawn
+        if (emitter.emitting && config.rate > 0.0f) {
+            emitter.spawnDebt += config.rate * deltaTime;
+            const size_t count = static_cast<size_t>(emitter.spawnDebt);
+            emitter.spawnDebt -= static_cast<float>(count);
+            Spawn(emitter, count);
+        }
+
+        if (emitter.pool.count > 0) {
+            ParticleMotion motion;
+            motion.gravityX = config.gravity.x;
+            motion.gravityY = config.gravity.y;
+            motion.damping = 1.0f / (1.0f + config.drag * deltaTime);
+            motion.startSize = config.startSize;
+            motion.endSize = config.endSize;
+            motion.startAlpha = config.startAlpha;
+            motion.endAlpha = config.endAlpha;
+            UpdateParticles(emitter.pool, motion, deltaTime);
+        }
+
+        ++m_stats.emitters;
+        m_stats.particles += emitter.pool.count;
+    }
+}
+
+void ParticleSystem::Spawn(Emitter& emitter, size_t count) {
+    const ParticleEmitterConfig& config = emitter.config;
+    ParticlePool& pool = emitter.pool;
+    count = std::min(count, pool.capacity - pool.count);
+    if (count == 0) return;
+
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    const float spread = config.spread * DEG_TO_RAD;
+    const float base = config.direction * DEG_TO_RAD - spread * 0.5f;
+
+    for (size_t n = 0; n < count; ++n) {
+        const size_t i = pool.count++;
+        const float angle = base + spread * unit(m_rng);
+        const float speed = config.speedMin + (config.speedMax - config.speedMin) * unit(m_rng);
+        const float lifetime = std::max(0.001f, config.lifetimeMin + (config.lifetimeMax - config.lifetimeMin) * unit(m_rng));
+        const float tint = unit(m_rng);
+
+        pool.x[i] = emitter.position.x;
+        pool.y[i] = emitter.position.y;
+        pool.vx[i] = std::cos(angle) * speed;
+        pool.vy[i] = std::sin(angle) * speed;
+        pool.life[i] = lifetime;
+        pool.invLifetime[i] = 1.0f / lifetime;
+        pool.size[i] = config.startSize;
+        pool.alpha[i] = config.startAlpha;
+
+        const auto mix = [tint](Uint8 a, Uint8 b) {
+            return static_cast<Uint8>(a + (static_cast<int>(b) - a) * tint);
+        };
+        pool.color[i] = PackColor({ mix(config.colorMin.r, config.colorMax.r),
+                                    mix(config.colorMin.g, config.colorMax.g),
+                                    mix(config.colorMin.b, config.colorMax.b), 255 });
+    }
+}
+
+// One DrawGeometry per texture: emitters sharing a texture go into the same batch
+void ParticleSystem::Draw(IRenderer* renderer, const SDL_Point& camera, float zoom) {
+    m_stats.drawCalls = 0;
+    m_stats.vertices = 0;
+    if (!renderer) return;
+
+    m_drawOrder.clear();
+    for (size_t i = 0; i < m_emitters.size(); ++i) {
+        if (m_emitters[i].alive && m_emitters[i].pool.count > 0) m_drawOrder.push_back(i);
+    }
+    std::stable_sort(m_drawOrder.begin(), m_drawOrder.end(), [this](size_t a, size_t b) {
+        return std::less<Texture*>{}(m_emitters[a].config.texture, m_emitters[b].config.texture);
+    });
+
+    m_vertices.clear();
+    Texture* batchTexture = nullptr;
+    for (size_t index : m_drawOrder) {
+        const Emitter& emitter = m_emitters[index];
+        if (emitter.config.texture != batchTexture) {
+            Flush(renderer, batchTexture);
+            batchTexture = emitter.config.texture;
+        }
+        AppendQuads(emitter, camera, zoom);
+    }
+    Flush(renderer, batchTexture);
+}
+
+void ParticleSystem::AppendQuads(const Emitter& emitter, const SDL_Point& camera, float zoom) {
+    const ParticlePool& pool = emitter.pool;
+    const float camX = static_cast<float>(camera.x);
+    const float camY = static_cast<float>(camera.y);
+
+    const size_t first = m_vertices.size();
+    m_vertices.resize(first + pool.count * 4);
+    SDL_Vertex* v = m_vertices.data() + first;
+
+    for (size_t i = 0; i < pool.count; ++i, v += 4) {
+        const float half = pool.size[i] * 0.5f * zoom;
+        const float cx = (pool.x[i] - camX) * zoom;
+        const float cy = (pool.y[i] - camY) * zoom;
+
+        const uint32_t rgb = pool.color[i];
+        const SDL_Color color{ static_cast<Uint8>(rgb >> 16), static_cast<Uint8>(rgb >> 8), static_cast<Uint8>(rgb),
+                               static_cast<Uint8>(std::clamp(pool.alpha[i], 0.0f, 1.0f) * 255.0f) };
+
+        v[0] = { { cx - half, cy - half }, color, { 0.0f, 0.0f } };
+        v[1] = { { cx + half, cy - half }, color, { 1.0f, 0.0f } };
+        v[2] = { { cx + half, cy + half }, color, { 1.0f, 1.0f } };
+        v[3] = { { cx - half, cy + half }, color, { 0.0f, 1.0f } };
+    }
+}
+
+void ParticleSystem::Flush(IRenderer* renderer, Texture* texture) {
+    if (m_vertices.empty()) return;
+
+    // Same two triangles per quad every frame, only grown
+    const size_t quads = m_vertices.size() / 4;
+    for (size_t q = m_indices.size() / 6; q < quads; ++q) {
+        const int base = static_cast<int>(q * 4);
+        m_indices.insert(m_indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+    }
+
+    renderer->DrawGeometry(texture ? texture->GetSDLTexture() : nullptr,
+                           m_vertices.data(), static_cast<int>(m_vertices.size()),
+                           m_indices.data(), static_cast<int>(quads * 6));
+
+    ++m_stats.drawCalls;
+    m_stats.vertices += m_vertices.size();
+    m_vertices.clear();
+}
+
+ParticleEmitterID ParticleSystem::CreateEmitter(const ParticleEmitterConfig& config, const VectorFloat& position) {
+    auto slot = std::find_if(m_emitters.begin(), m_emitters.end(), [](const Emitter& e) { return !e.alive; });
+    if (slot == m_emitters.end()) slot = m_emitters.emplace(m_emitters.end());
+
+    slot->config = config;
+    slot->pool.Reserve(config.capacity);
+    slot->position = position;
+    slot->spawnDebt = 0.0f;
+    slot->emitting = true;
+    slot->alive = true;
+    return static_cast<ParticleEmitterID>(slot - m_emitters.begin());
+}
+
+void ParticleSystem::DestroyEmitter(ParticleEmitterID emitter) {
+    if (Emitter* e = Find(emitter)) {
+        e->alive = false;
+        e->pool = {};
+    }
+}
+
+void ParticleSystem::Burst(ParticleEmitterID emitter, size_t count) {
+    if (Emitter* e = Find(emitter)) Spawn(*e, count);
+}
+
+ParticleSystem::Emitter* ParticleSystem::Find(ParticleEmitterID emitter) {
+    if (emitter >= m_emitters.size() || !m_emitters[emitter].alive) return nullptr;
+    return &m_emitters[emitter];
+}
+
+const ParticleSystem::Emitter* ParticleSystem::Find(ParticleEmitterID emitter) const {
+    if (emitter >= m_emitters.size() || !m_emitters[emitter].alive) return nullptr;
+    return &m_emitters[emitter];
+}
+
+// Setters
+void ParticleSystem::SetEmitterPosition(ParticleEmitterID emitter, const VectorFloat& position) {
+    if (Emitter* e = Find(emitter)) e->position = position;
+}
+
+void ParticleSystem::SetEmitting(ParticleEmitterID emitter, bool emitting) {
+    if (Emitter* e = Find(emitter)) e->emitting = emitting;
+}
+
+// Getters
+size_t ParticleSystem::GetParticleCount(ParticleEmitterID emitter) const {
+    const Emitter* e = Find(emitter);
+    return e ? e->pool.count : 0;
+}
+
+const ParticlePool* ParticleSystem::GetPool(ParticleEmitterID emitter) const {
+    const Emitter* e = Find(emitter);
+    return e ? &e->pool : nullptr;
+}
+
+const ParticleStats& ParticleSystem::GetStats() const {
+    return m_stats;
+}
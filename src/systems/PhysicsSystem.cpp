@@ -1,84 +1,337 @@
 #include "systems/PhysicsSystem.h"
+#include "systems/CollisionSystem.h"
+#include "systems/TileCollisionMap.h"
+#include "systems/ConstraintSolver.h"
+#include "systems/ForceFields.h"
+#include "level_manager/LevelData.h"
+
+#include <algorithm>
+#include <cmath>
 
 PhysicsSystem::PhysicsSystem(ComponentStorage<TransformComponent>& transforms,
                              ComponentStorage<AccelerationComponent>& accelerations,
                              ComponentStorage<PhysicsComponent>& physics)
-    : m_transforms{transforms}, m_accelerations{accelerations}, m_physics{physics} {}
+    : m_transforms{transforms}, m_accelerations{accelerations}, m_physics{physics},
+      m_sets{transforms, accelerations, physics} {}
 
 // Update state
 void PhysicsSystem::Update(float deltaTime) {
     const float GRAVITY = GetGravity();
 
-    for (auto& [id, phys] : m_physics.GetAll()) {
-        auto* transform = m_transforms.Get(id);
-        if (!transform) continue;
+    m_sets.Refresh();
+    if (m_sleepingEnabled) UpdateSleep();
 
-        auto* accel = m_accelerations.Get(id);
-        if (accel && phys.invMass > 0.0f) {
-            phys.velocity.x += accel->ax * deltaTime;
-            phys.velocity.y += accel->ay * deltaTime;
-        }
+    // Last step's CCD contacts were used for the islands; this step reports its own
+    if (m_collisionSystem) m_collisionSystem->ClearSweptContacts();
+
+    // Gather awake bodies
+    m_active.clear();
+    for (const DynamicBody& body : m_sets.GetDynamic()) {
+        if (!body.phys->isSleeping) m_active.push_back(body);
+    }
+
+    // Substepped bodies first: [0, substepCount) run N times at dt / N, the rest once at dt
+    size_t substepCount = 0;
+    if (m_substeps > 1) {
+        auto firstSlow = std::stable_partition(m_active.begin(), m_active.end(),
+                                               [this](const DynamicBody& body) { return NeedsSubsteps(*body.phys); });
+        substepCount = static_cast<size_t>(firstSlow - m_active.begin());
+    }
+    FillLanes(substepCount, deltaTime);
+
+    m_onTiles.assign(m_active.size(), 0);
+    m_grounded.assign(m_active.size(), 0);
+
+    // Everything substepped: every step solves all pairs and joints. Mixed: the first solve covers
+    // the whole frame, the later substeps only the pairs of substepped bodies.
+    const bool allSubstepped = substepCount > 0 && substepCount == m_active.size();
+    if (m_solver && substepCount > 0 && !allSubstepped) GatherSubstepPairs(substepCount);
+
+    // Velocities of the whole frame (first substep for the substepped bodies), then contacts
+    const float step = deltaTime / static_cast<float>(m_substeps);
+    IntegrateBodies(m_lanes, substepCount, m_active.size(), deltaTime, GRAVITY);
+    IntegrateBodies(m_lanes, 0, substepCount, step, GRAVITY);
+    if (m_solver) SolveContacts(allSubstepped ? step : deltaTime, false);
 
-        // Apply gravity
-        if (!phys.isGrounded && phys.invMass > 0.0f) {
-            phys.force.y += GRAVITY * phys.gravityScale * phys.mass;
+    // Single step
+    for (size_t i = substepCount; i < m_active.size(); ++i) {
+        m_onTiles[i] = Advance(i, deltaTime);
+    }
+
+    // Substeps - forces are applied in every step, impulses only in the first one
+    for (int substep = 0; substepCount > 0 && substep < m_substeps; ++substep) {
+        if (substep > 0) {
+            IntegrateBodies(m_lanes, 0, substepCount, step, GRAVITY);
+            if (m_solver) SolveContacts(step, !allSubstepped);
         }
 
-        // Apply impulses (instant velocity change)
-        if (phys.invMass > 0.0f) {
-            phys.velocity.x += phys.impulse.x * phys.invMass;
-            phys.velocity.y += phys.impulse.y * phys.invMass;
+        for (size_t i = 0; i < substepCount; ++i) {
+            m_onTiles[i] = Advance(i, step);
+            if (m_onTiles[i]) m_lanes.grounded[i] = 1.0f;
+            m_lanes.ix[i] = 0.0f;
+            m_lanes.iy[i] = 0.0f;
         }
+    }
+
+    for (size_t i = 0; i < m_active.size(); ++i) {
+        PhysicsComponent& phys = *m_active[i].phys;
+        phys.force = {0, 0};
         phys.impulse = {0, 0};
 
-        // Apply forces (F = m * a -> a = F * invMass)
-        if (phys.invMass > 0.0f) {
-            phys.velocity.x += phys.force.x * phys.invMass * deltaTime;
-            phys.velocity.y += phys.force.y * phys.invMass * deltaTime;
+        // Count frames at rest
+        const float finalSpeed = phys.velocity.Length();
+        phys.restFrames = finalSpeed < m_sleepSpeed ? std::min(phys.restFrames + 1, m_sleepFrames) : 0;
+
+        // Reset grounded (tile map, contact solver or CollisionSystem will set it again)
+        phys.isGrounded = m_onTiles[i] || m_grounded[i];
+    }
+}
+
+// Copy the awake bodies into the integrator lanes
+void PhysicsSystem::FillLanes(size_t substepCount, float deltaTime) {
+    // Damping is per step, spread it so N substeps remove as much as one frame
+    const float dampingExponent = 1.0f / static_cast<float>(m_substeps);
+
+    m_lanes.Resize(m_active.size());
+    for (size_t i = 0; i < m_active.size(); ++i) {
+        const PhysicsComponent& phys = *m_active[i].phys;
+        const AccelerationComponent& accel = *m_active[i].acceleration;
+
+        m_lanes.vx[i] = phys.velocity.x;
+        m_lanes.vy[i] = phys.velocity.y;
+        m_lanes.ax[i] = accel.ax + m_wind.x;
+        m_lanes.ay[i] = accel.ay + m_wind.y;
+        m_lanes.fx[i] = phys.force.x;
+        m_lanes.fy[i] = phys.force.y;
+        m_lanes.ix[i] = phys.impulse.x;
+        m_lanes.iy[i] = phys.impulse.y;
+        m_lanes.mass[i] = phys.mass;
+        m_lanes.invMass[i] = phys.invMass;
+        m_lanes.gravityScale[i] = phys.gravityScale;
+        m_lanes.friction[i] = phys.frictionKinetic;
+        m_lanes.damping[i] = i < substepCount
+            ? 1.0f - std::pow(1.0f - phys.linearDamping, dampingExponent)
+            : phys.linearDamping;
+        m_lanes.maxSpeed[i] = phys.maxSpeed;
+        m_lanes.grounded[i] = phys.isGrounded ? 1.0f : 0.0f;
+    }
+
+    // Field accelerations on top of the acceleration lanes
+    if (m_forceFields) {
+        m_points.resize(m_active.size());
+        for (size_t i = 0; i < m_active.size(); ++i) {
+            m_points[i] = m_active[i].transform->position;
         }
-        phys.force = {0, 0};
+        m_forceFields->Apply(m_lanes, m_points, 0, m_active.size(), deltaTime);
+    }
+}
+
+// Sequential impulses on this frame's CollisionSystem contacts and the joints, or in a mixed
+// substep only on the pairs of the substepped bodies [0, m_substepIds.size())
+void PhysicsSystem::SolveContacts(float deltaTime, bool substepPairsOnly) {
+    static const std::vector<std::pair<EntityID, EntityID>> noContacts;
+
+    for (size_t i = 0; i < m_active.size(); ++i) {
+        m_active[i].phys->velocity = { m_lanes.vx[i], m_lanes.vy[i] };
+    }
+
+    if (substepPairsOnly) {
+        m_solver->SolveSubstep(m_substepPairs, deltaTime);
+    } else {
+        m_solver->Solve(m_collisionSystem ? m_collisionSystem->GetCollisions() : noContacts, deltaTime);
+    }
+
+    // Single-step partners keep the reaction impulse for next frame, they have already moved
+    const size_t solved = substepPairsOnly ? m_substepIds.size() : m_active.size();
+    for (size_t i = 0; i < m_active.size(); ++i) {
+        m_lanes.vx[i] = m_active[i].phys->velocity.x;
+        m_lanes.vy[i] = m_active[i].phys->velocity.y;
+        if (i < solved) m_grounded[i] = m_solver->IsGrounded(m_active[i].id);
+    }
+}
+
+// This frame's contacts with at least one substepped body, for the later substeps
+void PhysicsSystem::GatherSubstepPairs(size_t substepCount) {
+    m_substepIds.clear();
+    m_substepPairs.clear();
+    for (size_t i = 0; i < substepCount; ++i) m_substepIds.push_back(m_active[i].id);
+    std::sort(m_substepIds.begin(), m_substepIds.end());
+
+    if (!m_collisionSystem) return;
+    for (const auto& pair : m_collisionSystem->GetCollisions()) {
+        if (std::binary_search(m_substepIds.begin(), m_substepIds.end(), pair.first) ||
+            std::binary_search(m_substepIds.begin(), m_substepIds.end(), pair.second)) {
+            m_substepPairs.push_back(pair);
+        }
+    }
+}
+
+// Move one body by its integrated velocity; returns true if it stands on the tile map
+bool PhysicsSystem::Advance(size_t index, float deltaTime) {
+    const auto& [id, physPtr, transform, accel] = m_active[index];
+    PhysicsComponent& phys = *physPtr;
 
-        // Apply friction (static + kinetic)
-        if (phys.isGrounded) {
-            float speed = std::sqrt(phys.velocity.x * phys.velocity.x +
-                                    phys.velocity.y * phys.velocity.y);
-
-            if (speed < 0.01f) {
-                phys.velocity = {0, 0}; // static friction stops object
-            } else {
-                float frictionForce = phys.frictionKinetic * phys.mass * GRAVITY;
-                VectorFloat frictionDir = {
-                    -phys.velocity.x / speed,
-                    -phys.velocity.y / speed
-                };
-
-                phys.velocity.x += frictionDir.x * frictionForce * phys.invMass * deltaTime;
-                phys.velocity.y += frictionDir.y * frictionForce * phys.invMass * deltaTime;
+    phys.velocity = { m_lanes.vx[index], m_lanes.vy[index] };
+
+    VectorFloat delta{ RealMul(phys.velocity.x, deltaTime), RealMul(phys.velocity.y, deltaTime) };
+    if (m_collisionSystem && m_lanes.speed[index] >= m_continuousThreshold) {
+        ClampToImpact(id, phys, delta);
+    }
+    const bool onTiles = m_tileMap && MoveOnTileMap(id, *transform, phys, delta);
+
+    transform->position.x = RealAdd(transform->position.x, delta.x);
+    transform->position.y = RealAdd(transform->position.y, delta.y);
+
+    // CCD / tile contacts may have removed velocity, the next substep starts from it
+    m_lanes.vx[index] = phys.velocity.x;
+    m_lanes.vy[index] = phys.velocity.y;
+    return onTiles;
+}
+
+// Adaptive mode substeps only bodies that will move fast this frame
+bool PhysicsSystem::NeedsSubsteps(const PhysicsComponent& phys) const {
+    if (!m_adaptiveSubsteps) return true;
+
+    const VectorFloat velocity = phys.velocity + phys.impulse * phys.invMass;
+    return velocity.Length() >= m_substepSpeed;
+}
+
+// Per-axis tile sweep; returns true if the body stands on the tile map
+bool PhysicsSystem::MoveOnTileMap(EntityID id, const TransformComponent& transform, PhysicsComponent& phys,
+                                  VectorFloat& delta) {
+    const auto* collider = m_colliders ? m_colliders->Get(id) : nullptr;
+    if (!collider || IsTrigger(*collider)) return false;
+
+    const AABB box{ transform.position.x, transform.position.y,
+                    static_cast<float>(collider->width), static_cast<float>(collider->height) };
+
+    TileContact contact;
+    delta = m_tileMap->Move(box, delta, contact);
+
+    if (contact.left || contact.right) phys.velocity.x = 0.0f;
+    if ((contact.ground && phys.velocity.y > 0.0f) || (contact.ceiling && phys.velocity.y < 0.0f)) {
+        phys.velocity.y = 0.0f;
+    }
+    return contact.ground;
+}
+
+// Wake disturbed sleepers, then put whole contact islands to sleep or wake them up
+void PhysicsSystem::UpdateSleep() {
+    m_bodies.clear();
+    m_bodyIndex.clear();
+    bool changed = false;
+
+    for (const DynamicBody& body : m_sets.GetDynamic()) {
+        PhysicsComponent& phys = *body.phys;
+        if (phys.invMass == 0.0f) continue;  // static bodies don't link islands
+
+        if (phys.isSleeping && IsDisturbed(body)) {
+            phys.Wake();
+            changed = true;
+        }
+        m_bodyIndex[body.id] = m_bodies.size();
+        m_bodies.push_back(body);
+    }
+
+    // Islands from the current contacts
+    m_islands.Reset(m_bodies.size());
+    if (m_collisionSystem) {
+        for (const auto* contacts : { &m_collisionSystem->GetCollisions(), &m_collisionSystem->GetSweptContacts() }) {
+            for (const auto& [a, b] : *contacts) {
+                auto itA = m_bodyIndex.find(a);
+                auto itB = m_bodyIndex.find(b);
+                if (itA != m_bodyIndex.end() && itB != m_bodyIndex.end()) {
+                    m_islands.Union(itA->second, itB->second);
+                }
             }
         }
+    }
 
-        // Apply linear damping (drag)
-        phys.velocity.x *= (1.0f - phys.linearDamping);
-        phys.velocity.y *= (1.0f - phys.linearDamping);
+    // An island sleeps only if every body in it is ready to
+    std::vector<char> islandAtRest(m_bodies.size(), 1);
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        const PhysicsComponent& phys = *m_bodies[i].phys;
+        const bool atRest = phys.isSleeping || (phys.canSleep && phys.restFrames >= m_sleepFrames);
+        if (!atRest) islandAtRest[m_islands.Find(i)] = 0;
+    }
 
-        // Clamp max speed
-        float speed = std::sqrt(phys.velocity.x * phys.velocity.x +
-                                phys.velocity.y * phys.velocity.y);
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        PhysicsComponent* phys = m_bodies[i].phys;
+        const bool sleep = islandAtRest[m_islands.Find(i)];
+        if (sleep == phys->isSleeping) continue;
 
-        if (speed > phys.maxSpeed) {
-            float scale = phys.maxSpeed / speed;
-            phys.velocity.x *= scale;
-            phys.velocity.y *= scale;
+        if (sleep) {
+            phys->isSleeping = true;
+            phys->velocity = {0, 0};
+            phys->restPosition = m_bodies[i].transform->position;
+        } else {
+            phys->Wake();
         }
+        changed = true;
+    }
+
+    if (changed && m_collisionSystem) {
+        m_collisionSystem->InvalidateStaticBodies();
+    }
+}
+
+// Impulses, forces, velocity or transform edits wake a sleeping body
+bool PhysicsSystem::IsDisturbed(const DynamicBody& body) const {
+    const PhysicsComponent& phys = *body.phys;
+    if (phys.impulse.x != 0.0f || phys.impulse.y != 0.0f) return true;
+    if (phys.force.x != 0.0f || phys.force.y != 0.0f) return true;
+    if (phys.velocity.x != 0.0f || phys.velocity.y != 0.0f) return true;
+
+    return body.transform->position.x != phys.restPosition.x ||
+           body.transform->position.y != phys.restPosition.y;
+}
+
+// Sub-frame TOI clamp - stop at the first surface instead of tunneling through it
+void PhysicsSystem::ClampToImpact(EntityID id, PhysicsComponent& phys, VectorFloat& delta) {
+    SweepHit hit;
+    if (!m_collisionSystem->Sweep(id, delta, hit)) return;
 
-        // Integrate position
-        transform->position.x += phys.velocity.x * deltaTime;
-        transform->position.y += phys.velocity.y * deltaTime;
+    delta = delta * hit.toi;
 
-        // Reset grounded (CollisionSystem will set it again)
-        phys.isGrounded = false;
+    // Remove velocity into the surface, keep sliding along it
+    const float into = phys.velocity.Dot(hit.normal);
+    if (into < 0.0f) {
+        phys.velocity = phys.velocity - hit.normal * into;
     }
+
+    m_collisionSystem->ReportContact(id, hit.entity);
 }
 
 void PhysicsSystem::SetGravity(float gravity) { m_gravity = gravity; }
+void PhysicsSystem::ApplyLevel(const LevelData& level) {
+    m_gravity = level.gravity;
+    m_wind = { level.ambientWindX, level.ambientWindY };
+}
+void PhysicsSystem::SetWind(const VectorFloat& wind) { m_wind = wind; }
+void PhysicsSystem::SetForceFields(ForceFields* forceFields) { m_forceFields = forceFields; }
+void PhysicsSystem::SetCollisionSystem(CollisionSystem* collisionSystem) { m_collisionSystem = collisionSystem; }
+void PhysicsSystem::SetConstraintSolver(ConstraintSolver* solver) { m_solver = solver; }
+void PhysicsSystem::SetContinuousThreshold(float speed) { m_continuousThreshold = speed; }
+void PhysicsSystem::SetTileMap(const TileCollisionMap* tileMap, ComponentStorage<ColliderComponent>* colliders) {
+    m_tileMap = tileMap;
+    m_colliders = colliders;
+}
+void PhysicsSystem::SetSubsteps(int count) { m_substeps = std::max(1, count); }
+void PhysicsSystem::SetAdaptiveSubsteps(bool enabled, float speedThreshold) {
+    m_adaptiveSubsteps = enabled;
+    m_substepSpeed = speedThreshold;
+}
+void PhysicsSystem::SetSleepThreshold(float speed, int frames) {
+    m_sleepSpeed = speed;
+    m_sleepFrames = frames;
+}
+void PhysicsSystem::SetSleepingEnabled(bool enabled) {
+    m_sleepingEnabled = enabled;
+    if (enabled) return;
+
+    for (auto& [id, phys] : m_physics.GetAll()) {
+        phys.Wake();
+    }
+    if (m_collisionSystem) m_collisionSystem->InvalidateStaticBodies();
+}
 const float PhysicsSystem::GetGravity() const { return m_gravity; }
@@ -1,6 +1,28 @@
 #include "systems/RenderSystem.h"
+#include "systems/ParticleSystem.h"
+#include "graphics/TilemapRenderer.h"
+
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
+namespace {
+    // Sprites are centred on their transform
+    AABB SpriteBounds(const TransformComponent& transform, const SpriteComponent& sprite) {
+        return { transform.position.x - sprite.width * 0.5f, transform.position.y - sprite.height * 0.5f,
+                 static_cast<float>(sprite.width), static_cast<float>(sprite.height) };
+    }
+
+    bool SameBounds(const AABB& a, const AABB& b) {
+        return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+    }
+
+    bool Overlaps(const AABB& a, const AABB& b) {
+        return a.x < b.x + b.w && a.x + a.w > b.x &&
+               a.y < b.y + b.h && a.y + a.h > b.y;
+    }
+}
+
 RenderSystem::RenderSystem(ComponentStorage<TransformComponent>& transforms,
                            ComponentStorage<SpriteComponent>& sprites,
                            IRenderer* renderer) 
@@ -12,18 +34,146 @@ void RenderSystem::Update(float deltaTime) {
         DrawBackgroundLayers();
     }
 
+    if (m_tilemap) {
+        m_tilemap->Draw(m_renderer, m_cameraPosition, m_viewport, m_cameraZoom);
+    }
+
+    // Added / removed sprites or transforms invalidate the proxies, otherwise only moved ones are re-inserted
+    if (m_sprites.GetVersion() != m_spriteVersion || m_transforms.GetVersion() != m_transformVersion) {
+        RebuildIndex();
+    } else {
+        RefreshBounds();
+    }
+    CollectVisible();
+
+    for (size_t index : m_visibleProxies) {
+        const SpriteProxy& proxy = m_proxies[index];
+        if (proxy.sprite->texture) QueueSprite(*proxy.transform, *proxy.sprite);
+    }
+    m_queue.Flush(m_renderer);
+
+    if (m_particles) {
+        m_particles->Draw(m_renderer, m_cameraPosition, m_cameraZoom);
+    }
+}
+
+void RenderSystem::QueueSprite(const TransformComponent& transform, const SpriteComponent& sprite) {
+    const SDL_FRect dstRect = {
+        (transform.position.x - sprite.width * 0.5f - m_cameraPosition.x) * m_cameraZoom,
+        (transform.position.y - sprite.height * 0.5f - m_cameraPosition.y) * m_cameraZoom,
+        sprite.width * m_cameraZoom,
+        sprite.height * m_cameraZoom
+    };
+
+    // Atlas sprites sample their region of the page
+    SDL_FRect uv{0.0f, 0.0f, 1.0f, 1.0f};
+    const int texW = sprite.texture->GetWidth(), texH = sprite.texture->GetHeight();
+    if (sprite.srcRect.w > 0 && sprite.srcRect.h > 0 && texW > 0 && texH > 0) {
+        uv = { static_cast<float>(sprite.srcRect.x) / texW, static_cast<float>(sprite.srcRect.y) / texH,
+               static_cast<float>(sprite.srcRect.w) / texW, static_cast<float>(sprite.srcRect.h) / texH };
+    }
+
+    const float sortY = sprite.ySort ? transform.position.y + sprite.height * 0.5f : 0.0f;
+    m_queue.Push(sprite.texture->GetSDLTexture(), sprite.layer, dstRect, uv, sortY);
+}
+
+// One proxy per sprite with a transform, sorted by id so the draw order is stable
+void RenderSystem::RebuildIndex() {
+    m_grid.Clear();
+    m_proxies.clear();
+
     for (auto& [id, sprite] : m_sprites.GetAll()) {
-        auto* transform = m_transforms.Get(id);
-        if (!transform || !sprite.texture) continue;
+        const auto* transform = m_transforms.Get(id);
+        if (!transform) continue;
+        m_proxies.push_back({ id, transform, &sprite, SpriteBounds(*transform, sprite), 0 });
+    }
+    std::sort(m_proxies.begin(), m_proxies.end(),
+              [](const SpriteProxy& a, const SpriteProxy& b) { return a.id < b.id; });
+
+    for (size_t index = 0; index < m_proxies.size(); ++index) InsertProxy(index);
+
+    m_spriteVersion = m_sprites.GetVersion();
+    m_transformVersion = m_transforms.GetVersion();
+    m_queryStamp = 0;
+    m_stats.sprites = m_proxies.size();
+    m_stats.moved = m_proxies.size();
+}
 
-        SDL_Rect dstRect = {
-            static_cast<int>((transform->position.x - sprite.width * 0.5f - m_cameraPosition.x) * m_cameraZoom),
-            static_cast<int>((transform->position.y - sprite.height * 0.5f - m_cameraPosition.y) * m_cameraZoom),
-            static_cast<int>(sprite.width * m_cameraZoom),
-            static_cast<int>(sprite.height * m_cameraZoom)
-        };
+void RenderSystem::RefreshBounds() {
+    m_stats.moved = 0;
+    for (size_t index = 0; index < m_proxies.size(); ++index) {
+        SpriteProxy& proxy = m_proxies[index];
+        const AABB bounds = SpriteBounds(*proxy.transform, *proxy.sprite);
+        if (SameBounds(bounds, proxy.bounds)) continue;
 
-        m_renderer->DrawTexture(sprite.texture->GetSDLTexture(), nullptr, &dstRect);
+        RemoveProxy(index);
+        proxy.bounds = bounds;
+        InsertProxy(index);
+        ++m_stats.moved;
+    }
+}
+
+// Only the cells under the camera rectangle are visited
+void RenderSystem::CollectVisible() {
+    m_visibleProxies.clear();
+
+    if (m_viewport.x <= 0 || m_viewport.y <= 0 || m_cameraZoom <= 0.0f) {
+        for (size_t index = 0; index < m_proxies.size(); ++index) m_visibleProxies.push_back(index);
+    } else {
+        const AABB view{ static_cast<float>(m_cameraPosition.x), static_cast<float>(m_cameraPosition.y),
+                         m_viewport.x / m_cameraZoom, m_viewport.y / m_cameraZoom };
+        const int cellSize = m_grid.GetCellSize();
+        const int startX = static_cast<int>(std::floor(view.x / cellSize));
+        const int endX   = static_cast<int>(std::floor((view.x + view.w) / cellSize));
+        const int startY = static_cast<int>(std::floor(view.y / cellSize));
+        const int endY   = static_cast<int>(std::floor((view.y + view.h) / cellSize));
+
+        ++m_queryStamp;
+        for (int cx = startX; cx <= endX; ++cx) {
+            for (int cy = startY; cy <= endY; ++cy) {
+                for (size_t index : m_grid.Query(cx, cy)) {
+                    SpriteProxy& proxy = m_proxies[index];
+                    if (proxy.stamp == m_queryStamp) continue;
+                    proxy.stamp = m_queryStamp;
+                    if (Overlaps(proxy.bounds, view)) m_visibleProxies.push_back(index);
+                }
+            }
+        }
+        std::sort(m_visibleProxies.begin(), m_visibleProxies.end());
+    }
+
+    m_visible.clear();
+    for (size_t index : m_visibleProxies) m_visible.push_back(m_proxies[index].id);
+    m_stats.visible = m_visible.size();
+}
+
+void RenderSystem::InsertProxy(size_t index) {
+    const AABB& box = m_proxies[index].bounds;
+    const int cellSize = m_grid.GetCellSize();
+    const int startX = static_cast<int>(std::floor(box.x / cellSize));
+    const int endX   = static_cast<int>(std::floor((box.x + box.w) / cellSize));
+    const int startY = static_cast<int>(std::floor(box.y / cellSize));
+    const int endY   = static_cast<int>(std::floor((box.y + box.h) / cellSize));
+
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            m_grid.Insert({cx, cy}, index);
+        }
+    }
+}
+
+void RenderSystem::RemoveProxy(size_t index) {
+    const AABB& box = m_proxies[index].bounds;
+    const int cellSize = m_grid.GetCellSize();
+    const int startX = static_cast<int>(std::floor(box.x / cellSize));
+    const int endX   = static_cast<int>(std::floor((box.x + box.w) / cellSize));
+    const int startY = static_cast<int>(std::floor(box.y / cellSize));
+    const int endY   = static_cast<int>(std::floor((box.y + box.h) / cellSize));
+
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            m_grid.Remove({cx, cy}, index);
+        }
     }
 }
 
@@ -109,7 +259,35 @@ void RenderSystem::SetViewportSize(SDL_Point size) {
     m_viewport = size;
 }
 
-// Getter
+void RenderSystem::SetRenderer(IRenderer* renderer) {
+    m_renderer = renderer;
+}
+
+void RenderSystem::SetParticleSystem(ParticleSystem* particles) {
+    m_particles = particles;
+}
+
+void RenderSystem::SetTilemap(TilemapRenderer* tilemap) {
+    m_tilemap = tilemap;
+}
+
+// Getters
 const SDL_Point& RenderSystem::GetCameraPosition() const {
     return m_cameraPosition;
 }
+
+const std::vector<EntityID>& RenderSystem::GetVisibleEntities() const {
+    return m_visible;
+}
+
+bool RenderSystem::IsVisible(EntityID entity) const {
+    return std::binary_search(m_visible.begin(), m_visible.end(), entity);
+}
+
+const RenderStats& RenderSystem::GetStats() const {
+    return m_stats;
+}
+
+const RenderQueueStats& RenderSystem::GetQueueStats() const {
+    return m_queue.GetStats();
+}
@@ -0,0 +1,328 @@
+#include "systems/SpatialQuery.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+
+namespace {
+    // Squared distance from point to box (0 if inside)
+    float DistanceSq(const VectorFloat& p, const AABB& b) {
+        const float dx = std::max({ b.x - p.x, 0.0f, p.x - (b.x + b.w) });
+        const float dy = std::max({ b.y - p.y, 0.0f, p.y - (b.y + b.h) });
+        return dx * dx + dy * dy;
+    }
+}
+
+SpatialQuery::SpatialQuery(const CollisionSystem& collisionSystem)
+    : m_collisionSystem{collisionSystem} {}
+
+// Amanatides & Woo grid traversal - visits cells in the order the ray crosses them
+template<typename Visitor>
+void SpatialQuery::TraverseRay(const VectorFloat& origin, const VectorFloat& dir, float maxDistance,
+                               Visitor&& visit) const {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    const float cellSize = static_cast<float>(m_collisionSystem.GetGrid().GetCellSize());
+
+    int cx = static_cast<int>(std::floor(origin.x / cellSize));
+    int cy = static_cast<int>(std::floor(origin.y / cellSize));
+
+    const int stepX = dir.x > 0.0f ? 1 : (dir.x < 0.0f ? -1 : 0);
+    const int stepY = dir.y > 0.0f ? 1 : (dir.y < 0.0f ? -1 : 0);
+
+    // Distance along the ray to the next vertical / horizontal cell border
+    float tMaxX = stepX > 0 ? ((cx + 1) * cellSize - origin.x) / dir.x
+                : stepX < 0 ? (cx * cellSize - origin.x) / dir.x : INF;
+    float tMaxY = stepY > 0 ? ((cy + 1) * cellSize - origin.y) / dir.y
+                : stepY < 0 ? (cy * cellSize - origin.y) / dir.y : INF;
+
+    const float tDeltaX = stepX != 0 ? cellSize / std::abs(dir.x) : INF;
+    const float tDeltaY = stepY != 0 ? cellSize / std::abs(dir.y) : INF;
+
+    float t = 0.0f;
+    while (t <= maxDistance) {
+        const float cellExit = std::min(tMaxX, tMaxY);
+        if (!visit(cx, cy, cellExit)) return;
+
+        if (tMaxX < tMaxY) {
+            t = tMaxX;
+            tMaxX += tDeltaX;
+            cx += stepX;
+        } else {
+            t = tMaxY;
+            tMaxY += tDeltaY;
+            cy += stepY;
+        }
+    }
+}
+
+bool SpatialQuery::Raycast(const VectorFloat& origin, const VectorFloat& direction, float maxDistance,
+                           RaycastHit& hit, CollisionLayer mask, EntityID ignore) const {
+    const VectorFloat dir = direction.Normalized();
+    if ((dir.x == 0.0f && dir.y == 0.0f) || maxDistance <= 0.0f) return false;
+
+    const auto& proxies = m_collisionSystem.GetProxies();
+    const AABB ray{ origin.x, origin.y, 0.0f, 0.0f };
+    const VectorFloat delta = dir * maxDistance;
+
+    bool found = false;
+    hit.distance = maxDistance;
+
+    TraverseRay(origin, dir, maxDistance, [&](int cx, int cy, float cellExit) {
+        m_collisionSystem.ForEachInCell(cx, cy, [&](size_t index) {
+            const ColliderProxy& proxy = proxies[index];
+            if (proxy.id == ignore || !HasAnyLayer(proxy.layer, mask)) return;
+
+            float toi;
+            VectorFloat normal;
+            if (!SweepAABB(ray, delta, proxy.bounds, toi, normal)) return;
+
+            const float distance = toi * maxDistance;
+            if (distance < hit.distance || !found) {
+                hit.entity = proxy.id;
+                hit.distance = distance;
+                hit.normal = normal;
+                found = true;
+            }
+        });
+        // Anything further away lies in cells we haven't reached yet
+        return !(found && hit.distance <= cellExit);
+    });
+
+    if (found) {
+        hit.point = origin + dir * hit.distance;
+    }
+    return found;
+}
+
+std::vector<RaycastHit> SpatialQuery::RaycastAll(const VectorFloat& origin, const VectorFloat& direction,
+                                                 float maxDistance, CollisionLayer mask, EntityID ignore) const {
+    std::vector<RaycastHit> hits;
+    const VectorFloat dir = direction.Normalized();
+    if ((dir.x == 0.0f && dir.y == 0.0f) || maxDistance <= 0.0f) return hits;
+
+    const auto& proxies = m_collisionSystem.GetProxies();
+    const AABB ray{ origin.x, origin.y, 0.0f, 0.0f };
+    const VectorFloat delta = dir * maxDistance;
+    std::unordered_set<size_t> tested;
+
+    TraverseRay(origin, dir, maxDistance, [&](int cx, int cy, float) {
+        m_collisionSystem.ForEachInCell(cx, cy, [&](size_t index) {
+            const ColliderProxy& proxy = proxies[index];
+            if (proxy.id == ignore || !HasAnyLayer(proxy.layer, mask)) return;
+            if (!tested.insert(index).second) return;
+
+            float toi;
+            VectorFloat normal;
+            if (SweepAABB(ray, delta, proxy.bounds, toi, normal)) {
+                RaycastHit hit;
+                hit.entity = proxy.id;
+                hit.distance = toi * maxDistance;
+                hit.point = origin + dir * hit.distance;
+                hit.normal = normal;
+                hits.push_back(hit);
+            }
+        });
+        return true;
+    });
+
+    std::sort(hits.begin(), hits.end(), [](const RaycastHit& a, const RaycastHit& b) {
+        return a.distance < b.distance || (a.distance == b.distance && a.entity < b.entity);
+    });
+    return hits;
+}
+
+// One cell holds every box that can contain the point
+std::vector<EntityID> SpatialQuery::OverlapPoint(const VectorFloat& point, CollisionLayer mask) const {
+    const auto& proxies = m_collisionSystem.GetProxies();
+    const float cellSize = static_cast<float>(m_collisionSystem.GetGrid().GetCellSize());
+    const int cx = static_cast<int>(std::floor(point.x / cellSize));
+    const int cy = static_cast<int>(std::floor(point.y / cellSize));
+
+    std::vector<EntityID> result;
+    m_collisionSystem.ForEachInCell(cx, cy, [&](size_t index) {
+        const ColliderProxy& proxy = proxies[index];
+        const AABB& b = proxy.bounds;
+        if (HasAnyLayer(proxy.layer, mask) &&
+            point.x >= b.x && point.x < b.x + b.w && point.y >= b.y && point.y < b.y + b.h) {
+            result.push_back(proxy.id);
+        }
+    });
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<EntityID> SpatialQuery::OverlapBox(const AABB& box, CollisionLayer mask) const {
+    const auto& proxies = m_collisionSystem.GetProxies();
+    const float cellSize = static_cast<float>(m_collisionSystem.GetGrid().GetCellSize());
+
+    const int startX = static_cast<int>(std::floor(box.x / cellSize));
+    const int endX   = static_cast<int>(std::floor((box.x + box.w) / cellSize));
+    const int startY = static_cast<int>(std::floor(box.y / cellSize));
+    const int endY   = static_cast<int>(std::floor((box.y + box.h) / cellSize));
+
+    std::vector<EntityID> result;
+    AABBLanes lanes;
+    EntityID laneEntity[AABB_BATCH];
+
+    auto flush = [&] {
+        const uint32_t hits = OverlapMask(box, lanes);
+        for (size_t lane = 0; lane < lanes.count; ++lane) {
+            if (hits & (1u << lane)) result.push_back(laneEntity[lane]);
+        }
+        lanes.count = 0;
+    };
+
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            m_collisionSystem.ForEachInCell(cx, cy, [&](size_t index) {
+                const ColliderProxy& proxy = proxies[index];
+                if (!HasAnyLayer(proxy.layer, mask)) return;
+
+                laneEntity[lanes.count] = proxy.id;
+                lanes.Push(proxy.bounds);
+                if (lanes.Full()) flush();
+            });
+        }
+    }
+    flush();
+
+    // Boxes spanning several cells are found more than once
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+std::vector<EntityID> SpatialQuery::OverlapCircle(const VectorFloat& center, float radius,
+                                                  CollisionLayer mask) const {
+    const auto& proxies = m_collisionSystem.GetProxies();
+    const float cellSize = static_cast<float>(m_collisionSystem.GetGrid().GetCellSize());
+    const float radiusSq = radius * radius;
+
+    const int startX = static_cast<int>(std::floor((center.x - radius) / cellSize));
+    const int endX   = static_cast<int>(std::floor((center.x + radius) / cellSize));
+    const int startY = static_cast<int>(std::floor((center.y - radius) / cellSize));
+    const int endY   = static_cast<int>(std::floor((center.y + radius) / cellSize));
+
+    std::vector<EntityID> result;
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            m_collisionSystem.ForEachInCell(cx, cy, [&](size_t index) {
+                const ColliderProxy& proxy = proxies[index];
+                if (HasAnyLayer(proxy.layer, mask) && DistanceSq(center, proxy.bounds) < radiusSq) {
+                    result.push_back(proxy.id);
+                }
+            });
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+// Search rings of cells around the point until the k-th candidate is closer than the next ring
+std::vector<EntityID> SpatialQuery::NearestK(const VectorFloat& point, size_t k, float maxDistance,
+                                             CollisionLayer mask, EntityID ignore) const {
+    std::vector<EntityID> result;
+    if (k == 0) return result;
+
+    const auto& proxies = m_collisionSystem.GetProxies();
+    const float cellSize = static_cast<float>(m_collisionSystem.GetGrid().GetCellSize());
+
+    const int cx = static_cast<int>(std::floor(point.x / cellSize));
+    const int cy = static_cast<int>(std::floor(point.y / cellSize));
+    const int maxRing = static_cast<int>(std::ceil(maxDistance / cellSize));
+    const float maxDistanceSq = maxDistance * maxDistance;
+
+    std::vector<std::pair<float, size_t>> candidates;  // (distanceSq, proxy index)
+    std::unordered_set<size_t> seen;
+
+    auto visitCell = [&](int x, int y) {
+        m_collisionSystem.ForEachInCell(x, y, [&](size_t index) {
+            if (!seen.insert(index).second) return;
+
+            const ColliderProxy& proxy = proxies[index];
+            if (proxy.id == ignore || !HasAnyLayer(proxy.layer, mask)) return;
+
+            const float distSq = DistanceSq(point, proxy.bounds);
+            if (distSq <= maxDistanceSq) {
+                candidates.push_back({ distSq, index });
+            }
+        });
+    };
+
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        if (ring == 0) {
+            visitCell(cx, cy);
+        } else {
+            for (int x = cx - ring; x <= cx + ring; ++x) {
+                visitCell(x, cy - ring);
+                visitCell(x, cy + ring);
+            }
+            for (int y = cy - ring + 1; y <= cy + ring - 1; ++y) {
+                visitCell(cx - ring, y);
+                visitCell(cx + ring, y);
+            }
+        }
+
+        // Everything outside the searched block is at least `ring` cells away
+        if (candidates.size() >= k) {
+            std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end());
+            const float bound = ring * cellSize;
+            if (candidates[k - 1].first <= bound * bound) break;
+        }
+        if (seen.size() == proxies.size()) break;
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [&](const auto& a, const auto& b) {
+        return a.first < b.first || (a.first == b.first && proxies[a.second].id < proxies[b.second].id);
+    });
+
+    for (size_t i = 0; i < candidates.size() && i < k; ++i) {
+        result.push_back(proxies[candidates[i].second].id);
+    }
+    return result;
+}
+
+bool SpatialQuery::SweepBox(const AABB& box, const VectorFloat& delta, SweepHit& hit,
+                            CollisionLayer mask, EntityID ignore) const {
+    if (delta.x == 0.0f && delta.y == 0.0f) return false;
+
+    const auto& proxies = m_collisionSystem.GetProxies();
+    const float cellSize = static_cast<float>(m_collisionSystem.GetGrid().GetCellSize());
+
+    // Swept bounds
+    const float minX = std::min(box.x, box.x + delta.x);
+    const float minY = std::min(box.y, box.y + delta.y);
+    const float maxX = std::max(box.x, box.x + delta.x) + box.w;
+    const float maxY = std::max(box.y, box.y + delta.y) + box.h;
+
+    const int startX = static_cast<int>(std::floor(minX / cellSize));
+    const int endX   = static_cast<int>(std::floor(maxX / cellSize));
+    const int startY = static_cast<int>(std::floor(minY / cellSize));
+    const int endY   = static_cast<int>(std::floor(maxY / cellSize));
+
+    // Boxes in several cells are just tested again, the earliest hit doesn't change
+    bool found = false;
+    hit.toi = 1.0f;
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            m_collisionSystem.ForEachInCell(cx, cy, [&](size_t index) {
+                const ColliderProxy& proxy = proxies[index];
+                if (proxy.id == ignore || !HasAnyLayer(proxy.layer, mask)) return;
+
+                float toi;
+                VectorFloat normal;
+                if (SweepAABB(box, delta, proxy.bounds, toi, normal) && toi < hit.toi) {
+                    hit.entity = proxy.id;
+                    hit.toi = toi;
+                    hit.normal = normal;
+                    found = true;
+                }
+            });
+        }
+    }
+    return found;
+}
@@ -0,0 +1,255 @@
+#include "systems/TileCollisionMap.h"
+#include "level_manager/LevelData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    constexpr float EPS = 0.001f;         // keeps touching edges out of the tile range
+    constexpr float GROUND_PROBE = 1.0f;  // px below the feet that still counts as standing
+
+    TileShape CharToTile(char c) {
+        switch (c) {
+            case '#':  return TileShape::Solid;
+            case '=':  return TileShape::OneWay;
+            case '/':  return TileShape::SlopeUp;
+            case '\\': return TileShape::SlopeDown;
+            default:   return TileShape::Empty;
+        }
+    }
+}
+
+bool TileCollisionMap::LoadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "TileCollisionMap: Failed to open " << path << "\n";
+        return false;
+    }
+
+    nlohmann::json j;
+    try {
+        file >> j;
+    } catch (const std::exception& e) {
+        std::cerr << "TileCollisionMap: JSON parse error: " << e.what() << "\n";
+        return false;
+    }
+    return LoadFromJson(j);
+}
+
+bool TileCollisionMap::LoadFromJson(const nlohmann::json& j) {
+    if (!j.contains("rows") || !j["rows"].is_array()) {
+        std::cerr << "TileCollisionMap: missing \"rows\"\n";
+        return false;
+    }
+
+    const auto& rows = j["rows"];
+    int width = 0;
+    for (const auto& row : rows) {
+        width = std::max(width, static_cast<int>(row.get<std::string>().size()));
+    }
+
+    VectorFloat origin{0.0f, 0.0f};
+    if (j.contains("origin") && j["origin"].size() == 2) {
+        origin = { j["origin"][0].get<float>(), j["origin"][1].get<float>() };
+    }
+
+    Resize(width, static_cast<int>(rows.size()), j.value("tileSize", 32), origin);
+    for (int y = 0; y < m_height; ++y) {
+        const std::string row = rows[y].get<std::string>();
+        for (int x = 0; x < static_cast<int>(row.size()); ++x) {
+            SetTile(x, y, CharToTile(row[x]));
+        }
+    }
+    return true;
+}
+
+bool TileCollisionMap::LoadLevel(const LevelData& level) {
+    if (level.tilemapPath.empty()) return false;
+    return LoadFromFile(level.tilemapPath);
+}
+
+void TileCollisionMap::Resize(int width, int height, int tileSize, VectorFloat origin) {
+    m_width = std::max(0, width);
+    m_height = std::max(0, height);
+    m_tileSize = std::max(1, tileSize);
+    m_origin = origin;
+    m_tiles.assign(static_cast<size_t>(m_width) * m_height, static_cast<uint8_t>(TileShape::Empty));
+}
+
+void TileCollisionMap::SetTile(int x, int y, TileShape shape) {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) return;
+    m_tiles[static_cast<size_t>(y) * m_width + x] = static_cast<uint8_t>(shape);
+}
+
+TileShape TileCollisionMap::GetTile(int x, int y) const {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) return TileShape::Empty;
+    return static_cast<TileShape>(m_tiles[static_cast<size_t>(y) * m_width + x]);
+}
+
+bool TileCollisionMap::IsLoaded() const { return !m_tiles.empty(); }
+int TileCollisionMap::GetWidth() const { return m_width; }
+int TileCollisionMap::GetHeight() const { return m_height; }
+int TileCollisionMap::GetTileSize() const { return m_tileSize; }
+
+int TileCollisionMap::ToTileX(float x) const {
+    return static_cast<int>(std::floor((x - m_origin.x) / m_tileSize));
+}
+
+int TileCollisionMap::ToTileY(float y) const {
+    return static_cast<int>(std::floor((y - m_origin.y) / m_tileSize));
+}
+
+bool TileCollisionMap::IsSlope(TileShape shape) const {
+    return shape == TileShape::SlopeUp || shape == TileShape::SlopeDown;
+}
+
+float TileCollisionMap::SlopeSurface(int tx, int ty, float x) const {
+    const float size = static_cast<float>(m_tileSize);
+    const float left = m_origin.x + tx * size;
+    const float top = m_origin.y + ty * size;
+    const float local = std::clamp(x - left, 0.0f, size);
+
+    return GetTile(tx, ty) == TileShape::SlopeUp ? top + size - local : top + local;
+}
+
+VectorFloat TileCollisionMap::Move(const AABB& box, const VectorFloat& delta, TileContact& contact) const {
+    contact = {};
+    if (!IsLoaded()) return delta;
+
+    AABB moved = box;
+    const float dx = MoveX(moved, delta.x, contact);
+    moved.x += dx;
+
+    const float dy = MoveY(moved, delta.y, contact);
+    moved.y += dy;
+
+    if (!contact.ground && delta.y >= 0.0f) {
+        contact.ground = IsOnGround(moved);
+    }
+    return { dx, dy };
+}
+
+// Sweep the leading edge column by column, stop at the first solid tile
+float TileCollisionMap::MoveX(const AABB& box, float dx, TileContact& contact) const {
+    if (dx == 0.0f) return 0.0f;
+
+    const int top = ToTileY(box.y + EPS);
+    int bottom = ToTileY(box.y + box.h - EPS);
+
+    // Walking on a slope: the bottom row is the slope itself, the Y pass lifts the box over it
+    const int footX = ToTileX(box.x + box.w * 0.5f);
+    if (IsSlope(GetTile(footX, bottom))) --bottom;
+
+    const float size = static_cast<float>(m_tileSize);
+    if (dx > 0.0f) {
+        const float lead = box.x + box.w;
+        const int first = ToTileX(lead - EPS) + 1;
+        const int last = ToTileX(lead + dx - EPS);
+        for (int tx = first; tx <= last; ++tx) {
+            for (int ty = top; ty <= bottom; ++ty) {
+                if (GetTile(tx, ty) != TileShape::Solid) continue;
+                contact.right = true;
+                return std::max(0.0f, m_origin.x + tx * size - lead);
+            }
+        }
+    } else {
+        const float lead = box.x;
+        const int first = ToTileX(lead + EPS) - 1;
+        const int last = ToTileX(lead + dx + EPS);
+        for (int tx = first; tx >= last; --tx) {
+            for (int ty = top; ty <= bottom; ++ty) {
+                if (GetTile(tx, ty) != TileShape::Solid) continue;
+                contact.left = true;
+                return std::min(0.0f, m_origin.x + (tx + 1) * size - lead);
+            }
+        }
+    }
+    return dx;
+}
+
+// Sweep the leading edge row by row; slopes are sampled under the middle of the box
+float TileCollisionMap::MoveY(const AABB& box, float dy, TileContact& contact) const {
+    const float size = static_cast<float>(m_tileSize);
+    const int left = ToTileX(box.x + EPS);
+    const int right = ToTileX(box.x + box.w - EPS);
+
+    if (dy < 0.0f) {
+        const float lead = box.y;
+        const int first = ToTileY(lead + EPS) - 1;
+        const int last = ToTileY(lead + dy + EPS);
+        for (int ty = first; ty >= last; --ty) {
+            for (int tx = left; tx <= right; ++tx) {
+                if (GetTile(tx, ty) != TileShape::Solid) continue;
+                contact.ceiling = true;
+                return std::min(0.0f, m_origin.y + (ty + 1) * size - lead);
+            }
+        }
+        return dy;
+    }
+
+    const float lead = box.y + box.h;
+    float allowed = dy;
+
+    // Flat floors: solid and one-way tiles fully below the feet
+    const int first = ToTileY(lead - EPS) + 1;
+    const int last = ToTileY(lead + dy - EPS);
+    for (int ty = first; ty <= last && allowed == dy; ++ty) {
+        for (int tx = left; tx <= right; ++tx) {
+            const TileShape tile = GetTile(tx, ty);
+            if (tile != TileShape::Solid && tile != TileShape::OneWay) continue;
+            allowed = std::max(0.0f, m_origin.y + ty * size - lead);
+            contact.ground = true;
+            break;
+        }
+    }
+
+    const float footX = box.x + box.w * 0.5f;
+    const int tx = ToTileX(footX);
+
+    // Top of a slope: MoveX let the feet into the solid tile the slope leads to, step onto it
+    const int footRow = ToTileY(lead - EPS);
+    const float footTop = m_origin.y + footRow * size;
+    if (GetTile(tx, footRow) == TileShape::Solid && lead > footTop && lead - footTop <= size * 0.5f) {
+        contact.ground = true;
+        return footTop - lead;
+    }
+
+    // Slopes: the floor under the middle of the box, may push it up when walking uphill
+    for (int ty = ToTileY(lead - EPS); ty <= ToTileY(lead + allowed - EPS); ++ty) {
+        if (!IsSlope(GetTile(tx, ty))) continue;
+
+        const float surface = SlopeSurface(tx, ty, footX);
+        if (lead + allowed > surface && lead - surface <= size) {
+            allowed = surface - lead;
+            contact.ground = true;
+        }
+        break;
+    }
+    return allowed;
+}
+
+bool TileCollisionMap::IsOnGround(const AABB& box) const {
+    const float lead = box.y + box.h;
+    const int ty = ToTileY(lead + GROUND_PROBE - EPS);
+
+    // Flat floor just below the feet
+    if (ty != ToTileY(lead - EPS)) {
+        for (int tx = ToTileX(box.x + EPS); tx <= ToTileX(box.x + box.w - EPS); ++tx) {
+            const TileShape tile = GetTile(tx, ty);
+            if (tile == TileShape::Solid || tile == TileShape::OneWay) return true;
+        }
+    }
+
+    // Slope surface under the middle
+    const float footX = box.x + box.w * 0.5f;
+    const int tx = ToTileX(footX);
+    for (int row = ToTileY(lead - EPS); row <= ty; ++row) {
+        if (IsSlope(GetTile(tx, row))) {
+            const float surface = SlopeSurface(tx, row, footX);
+            return lead >= surface - GROUND_PROBE && lead <= surface + EPS;
+        }
+    }
+    return false;
+}
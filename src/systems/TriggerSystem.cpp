@@ -0,0 +1,172 @@
+#include "systems/TriggerSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    bool Overlaps(const AABB& a, const AABB& b) {
+        return a.x < b.x + b.w && a.x + a.w > b.x &&
+               a.y < b.y + b.h && a.y + a.h > b.y;
+    }
+
+    bool SameBounds(const AABB& a, const AABB& b) {
+        return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+    }
+}
+
+TriggerSystem::TriggerSystem(ComponentStorage<TransformComponent>& transforms,
+                             ComponentStorage<ColliderComponent>& colliders)
+    : m_transforms{transforms}, m_colliders{colliders} {}
+
+void TriggerSystem::Update(float deltaTime) {
+    m_events.clear();
+
+    // Added / removed components bump the versions - rescan triggers and movers.
+    // Static triggers cost nothing here; moving one goes through InvalidateTriggers()
+    const bool rebuilt = m_dirty ||
+                         m_colliders.GetVersion() != m_colliderVersion ||
+                         m_transforms.GetVersion() != m_transformVersion;
+    if (rebuilt) Rebuild();
+
+    for (Mover& mover : m_movers) {
+        // Pointers from the last Rebuild - valid while the versions match
+        const TransformComponent* t = mover.transform;
+        const ColliderComponent* c = mover.collider;
+
+        // Became a trigger - rescan next frame
+        if (IsTrigger(*c)) {
+            m_dirty = true;
+            continue;
+        }
+
+        const AABB bounds{ t->position.x, t->position.y,
+                           static_cast<float>(c->width), static_cast<float>(c->height) };
+
+        // Resting bodies keep their enter / exit state
+        if (!rebuilt && SameBounds(bounds, mover.bounds)) continue;
+
+        mover.bounds = bounds;
+        QueryMover(mover, *c);
+    }
+}
+
+// Rescan all colliders: triggers go to the grid, the rest become movers
+void TriggerSystem::Rebuild() {
+    m_grid.Clear();
+    m_triggers.clear();
+    m_movers.clear();
+
+    for (auto& [id, collider] : m_colliders.GetAll()) {
+        const auto* t = m_transforms.Get(id);
+        if (!t) continue;
+
+        const AABB bounds{ t->position.x, t->position.y,
+                           static_cast<float>(collider.width), static_cast<float>(collider.height) };
+
+        if (IsTrigger(collider)) {
+            m_triggers.push_back({ id, bounds, collider.layer, collider.mask, 0 });
+        } else {
+            m_movers.push_back({ id, bounds, t, &collider });
+        }
+    }
+
+    // Stable order -> stable event order
+    std::sort(m_triggers.begin(), m_triggers.end(),
+              [](const ColliderProxy& a, const ColliderProxy& b) { return a.id < b.id; });
+    std::sort(m_movers.begin(), m_movers.end(),
+              [](const Mover& a, const Mover& b) { return a.id < b.id; });
+
+    const int cellSize = m_grid.GetCellSize();
+    for (size_t index = 0; index < m_triggers.size(); ++index) {
+        const AABB& box = m_triggers[index].bounds;
+
+        const int startX = static_cast<int>(std::floor(box.x / cellSize));
+        const int endX   = static_cast<int>(std::floor((box.x + box.w) / cellSize));
+        const int startY = static_cast<int>(std::floor(box.y / cellSize));
+        const int endY   = static_cast<int>(std::floor((box.y + box.h) / cellSize));
+
+        for (int cx = startX; cx <= endX; ++cx) {
+            for (int cy = startY; cy <= endY; ++cy) {
+                m_grid.Insert({cx, cy}, index);
+            }
+        }
+    }
+
+    // Exit everything that was inside a removed trigger or was a removed mover
+    static const std::vector<EntityID> none;
+    for (auto it = m_inside.begin(); it != m_inside.end();) {
+        const EntityID mover = it->first;
+        const auto* c = m_colliders.Get(mover);
+        if (!c || IsTrigger(*c)) {
+            Diff(mover, it->second, none);
+            it = m_inside.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    m_colliderVersion = m_colliders.GetVersion();
+    m_transformVersion = m_transforms.GetVersion();
+    m_dirty = false;
+}
+
+void TriggerSystem::QueryMover(const Mover& mover, const ColliderComponent& collider) {
+    const int cellSize = m_grid.GetCellSize();
+    const AABB& box = mover.bounds;
+
+    const int startX = static_cast<int>(std::floor(box.x / cellSize));
+    const int endX   = static_cast<int>(std::floor((box.x + box.w) / cellSize));
+    const int startY = static_cast<int>(std::floor(box.y / cellSize));
+    const int endY   = static_cast<int>(std::floor((box.y + box.h) / cellSize));
+
+    m_overlaps.clear();
+    for (int cx = startX; cx <= endX; ++cx) {
+        for (int cy = startY; cy <= endY; ++cy) {
+            for (size_t index : m_grid.Query(cx, cy)) {
+                const ColliderProxy& trigger = m_triggers[index];
+                if (!HasAnyLayer(trigger.mask, collider.layer) && !HasAnyLayer(collider.mask, trigger.layer)) continue;
+                if (Overlaps(box, trigger.bounds)) m_overlaps.push_back(trigger.id);
+            }
+        }
+    }
+    std::sort(m_overlaps.begin(), m_overlaps.end());
+    m_overlaps.erase(std::unique(m_overlaps.begin(), m_overlaps.end()), m_overlaps.end());
+
+    auto it = m_inside.find(mover.id);
+    if (it == m_inside.end()) {
+        if (m_overlaps.empty()) return;
+        it = m_inside.emplace(mover.id, std::vector<EntityID>{}).first;
+    }
+    Diff(mover.id, it->second, m_overlaps);
+    if (it->second.empty()) m_inside.erase(it);
+}
+
+// Both lists sorted - emit exits for triggers left, enters for new ones
+void TriggerSystem::Diff(EntityID mover, std::vector<EntityID>& inside, const std::vector<EntityID>& now) {
+    size_t i = 0, j = 0;
+    while (i < inside.size() || j < now.size()) {
+        if (j == now.size() || (i < inside.size() && inside[i] < now[j])) {
+            m_events.emplace_back(inside[i++], mover, TriggerPhase::Exit);
+        } else if (i == inside.size() || now[j] < inside[i]) {
+            m_events.emplace_back(now[j++], mover, TriggerPhase::Enter);
+        } else {
+            ++i;
+            ++j;
+        }
+    }
+    inside = now;
+}
+
+const std::vector<TriggerEvent>& TriggerSystem::GetEvents() const {
+    return m_events;
+}
+
+void TriggerSystem::InvalidateTriggers() {
+    m_dirty = true;
+}
+
+bool TriggerSystem::IsInside(EntityID other, EntityID trigger) const {
+    auto it = m_inside.find(other);
+    return it != m_inside.end() &&
+           std::binary_search(it->second.begin(), it->second.end(), trigger);
+}
@@ -3,7 +3,7 @@
 
 Window::Window()
     : m_window(nullptr), m_width(0), m_height(0),
-      m_isRunning(false), m_isFullscreen(false) {}
+      m_isRunning(false), m_isFullscreen(false), m_renderTargetsReset(false) {}
 
 Window::~Window() {
     Shutdown();
@@ -132,6 +132,10 @@ void Window::PollEvents() {
         if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) {
             m_isRunning = false;
         }
+        // Target textures lost their contents (e.g. Direct3D device loss, resize)
+        if (event.type == SDL_RENDER_TARGETS_RESET) {
+            m_renderTargetsReset = true;
+        }
         if (event.type == SDL_WINDOWEVENT) {
             switch (event.window.event) {
                 case SDL_WINDOWEVENT_RESIZED:
@@ -145,3 +149,9 @@ void Window::PollEvents() {
         }
     }
 }
+
+bool Window::ConsumeRenderTargetsReset() {
+    const bool reset = m_renderTargetsReset;
+    m_renderTargetsReset = false;
+    return reset;
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "graphics/AtlasPacker.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+    struct Placed {
+        AtlasSlot slot;
+        int w, h;
+    };
+
+    bool Overlap(const Placed& a, const Placed& b) {
+        return a.slot.page == b.slot.page &&
+               a.slot.x < b.slot.x + b.w && a.slot.x + a.w > b.slot.x &&
+               a.slot.y < b.slot.y + b.h && a.slot.y + a.h > b.slot.y;
+    }
+}
+
+TEST(AtlasPackerTest, RectanglesStayInsideTheirPageAndNeverOverlap) {
+    AtlasPacker packer(256, 256);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> size(4, 80);
+
+    std::vector<Placed> placed;
+    for (int i = 0; i < 200; ++i) {
+        Placed p{ {}, size(rng), size(rng) };
+        ASSERT_TRUE(packer.Insert(p.w, p.h, p.slot));
+        EXPECT_GE(p.slot.x, 0);
+        EXPECT_GE(p.slot.y, 0);
+        EXPECT_LE(p.slot.x + p.w, 256);
+        EXPECT_LE(p.slot.y + p.h, packer.GetUsedHeight(p.slot.page));
+        placed.push_back(p);
+    }
+
+    for (size_t i = 0; i < placed.size(); ++i) {
+        for (size_t j = i + 1; j < placed.size(); ++j) {
+            EXPECT_FALSE(Overlap(placed[i], placed[j])) << i << " vs " << j;
+        }
+    }
+    EXPECT_GT(packer.GetPageCount(), 1);
+}
+
+TEST(AtlasPackerTest, EqualTilesFillAPageWithoutGaps) {
+    AtlasPacker packer(128, 128);
+
+    // 16 tiles of 32x32 fill one page exactly
+    for (int i = 0; i < 16; ++i) {
+        AtlasSlot slot;
+        ASSERT_TRUE(packer.Insert(32, 32, slot));
+        EXPECT_EQ(slot.page, 0);
+    }
+    EXPECT_EQ(packer.GetUsedHeight(0), 128);
+
+    AtlasSlot next;
+    ASSERT_TRUE(packer.Insert(32, 32, next));
+    EXPECT_EQ(next.page, 1);
+    EXPECT_EQ(next.x, 0);
+    EXPECT_EQ(next.y, 0);
+}
+
+TEST(AtlasPackerTest, FillsLowSpotsBeforeGrowingTaller) {
+    AtlasPacker packer(100, 100);
+    AtlasSlot tall, shortOne, filler;
+    ASSERT_TRUE(packer.Insert(50, 60, tall));
+    ASSERT_TRUE(packer.Insert(50, 20, shortOne));
+    ASSERT_TRUE(packer.Insert(50, 30, filler));
+
+    // The third one stacks on the short column, not on the tall one
+    EXPECT_EQ(filler.x, shortOne.x);
+    EXPECT_EQ(filler.y, 20);
+    EXPECT_EQ(packer.GetUsedHeight(0), 60);
+}
+
+TEST(AtlasPackerTest, RejectsRectanglesLargerThanAPage) {
+    AtlasPacker packer(64, 64);
+    AtlasSlot slot;
+    EXPECT_FALSE(packer.Insert(65, 10, slot));
+    EXPECT_FALSE(packer.Insert(10, 65, slot));
+    EXPECT_FALSE(packer.Insert(0, 10, slot));
+    EXPECT_EQ(packer.GetPageCount(), 0);
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include "systems/CharacterControllerSystem.h"
+#include "systems/CollisionSystem.h"
+#include "systems/SpatialQuery.h"
+#include "systems/TileCollisionMap.h"
+#include "systems/EntityCreationSystem.h"
+#include "core/EntityManager.h"
+#include "core/ComponentStorage.h"
+#include "components/TransformComponent.h"
+#include "components/ColliderComponent.h"
+#include "components/CharacterControllerComponent.h"
+
+class CharacterControllerTest : public ::testing::Test {
+protected:
+    EntityManager entityManager;
+    EntityCreationSystem creationSystem{&entityManager};
+
+    ComponentStorage<TransformComponent> transforms;
+    ComponentStorage<ColliderComponent> colliders;
+    ComponentStorage<CharacterControllerComponent> controllers;
+
+    CollisionSystem collisionSystem{entityManager, transforms, colliders};
+    SpatialQuery query{collisionSystem};
+    CharacterControllerSystem system{transforms, colliders, controllers};
+
+    void SetUp() override {
+        creationSystem.RegisterStorage(&transforms);
+        creationSystem.RegisterStorage(&colliders);
+        creationSystem.RegisterStorage(&controllers);
+        system.SetSpatialQuery(&query);
+    }
+
+    EntityID CreateBlock(float x, float y, int w, int h) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            ColliderComponent{w, h, CollisionLayer::Wall, CollisionLayer::None}
+        );
+    }
+
+    // 16 x 32 walker, feet at `feetY`
+    EntityID CreateWalker(float x, float feetY, float moveX = 0.0f) {
+        CharacterControllerComponent controller;
+        controller.moveX = moveX;
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, feetY - 32.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            ColliderComponent{16, 32, CollisionLayer::Enemy, CollisionLayer::Wall},
+            controller
+        );
+    }
+
+    float Feet(EntityID id) { return transforms.Get(id)->position.y + 32.0f; }
+
+    void Step(int frames) {
+        for (int i = 0; i < frames; ++i) {
+            collisionSystem.Update(1.0f / 60.0f);
+            system.Update(1.0f / 60.0f);
+        }
+    }
+};
+
+TEST_F(CharacterControllerTest, LandsAndSlidesIntoWall) {
+    CreateBlock(-200.0f, 400.0f, 800, 40);   // floor
+    CreateBlock(200.0f, 300.0f, 20, 100);    // wall
+    EntityID walker = CreateWalker(0.0f, 350.0f, 1.0f);
+
+    Step(120);
+
+    const auto* controller = controllers.Get(walker);
+    EXPECT_TRUE(controller->isGrounded);
+    EXPECT_TRUE(controller->hitWall);
+    EXPECT_NEAR(Feet(walker), 400.0f, 0.05f);
+    EXPECT_NEAR(transforms.Get(walker)->position.x + 16.0f, 200.0f, 0.05f);
+}
+
+TEST_F(CharacterControllerTest, OneSweepPerAxisOnOpenGround) {
+    CreateBlock(-2000.0f, 400.0f, 4000, 40);
+    for (int i = 0; i < 100; ++i) CreateWalker(-1500.0f + i * 30.0f, 400.0f, 1.0f);
+
+    Step(30);
+
+    EXPECT_EQ(system.GetStats().controllers, 100u);
+    EXPECT_EQ(system.GetStats().sweeps, 200u);
+}
+
+TEST_F(CharacterControllerTest, StepsOntoLowLedgeButNotTallOne) {
+    CreateBlock(-200.0f, 400.0f, 2000, 40);
+    CreateBlock(100.0f, 394.0f, 200, 6);     // 6 px ledge
+    CreateBlock(600.0f, 380.0f, 200, 20);    // 20 px block
+    EntityID low = CreateWalker(40.0f, 400.0f, 1.0f);
+    EntityID high = CreateWalker(540.0f, 400.0f, 1.0f);
+
+    Step(60);
+
+    EXPECT_GT(transforms.Get(low)->position.x, 120.0f);
+    EXPECT_NEAR(Feet(low), 394.0f, 0.05f);
+    EXPECT_TRUE(controllers.Get(low)->isGrounded);
+
+    EXPECT_NEAR(transforms.Get(high)->position.x + 16.0f, 600.0f, 0.05f);
+    EXPECT_NEAR(Feet(high), 400.0f, 0.05f);
+}
+
+TEST_F(CharacterControllerTest, SnapsDownStepsInsteadOfFalling) {
+    CreateBlock(-200.0f, 400.0f, 300, 40);   // upper floor ends at x = 100
+    CreateBlock(100.0f, 403.0f, 300, 40);    // 3 px lower
+    EntityID walker = CreateWalker(0.0f, 400.0f, 1.0f);
+    Step(1);
+
+    for (int i = 0; i < 60; ++i) {
+        Step(1);
+        EXPECT_TRUE(controllers.Get(walker)->isGrounded) << i;
+    }
+    EXPECT_GT(transforms.Get(walker)->position.x, 100.0f);
+    EXPECT_NEAR(Feet(walker), 403.0f, 0.05f);
+}
+
+TEST_F(CharacterControllerTest, CoyoteTimeAllowsLateJump) {
+    CreateBlock(-200.0f, 400.0f, 300, 40);   // ledge ends at x = 100, nothing below
+    EntityID late = CreateWalker(80.0f, 400.0f, 1.0f);
+    EntityID tooLate = CreateWalker(80.0f, 400.0f, 1.0f);
+    controllers.Get(late)->snapDistance = 0.0f;
+    controllers.Get(tooLate)->snapDistance = 0.0f;
+
+    // Both walk off the edge; 160 px/s -> off after ~6 frames
+    Step(9);
+    ASSERT_FALSE(controllers.Get(late)->isGrounded);
+    controllers.Get(late)->jump = true;
+    Step(1);
+    EXPECT_LT(controllers.Get(late)->velocity.y, 0.0f);
+
+    Step(10);
+    controllers.Get(tooLate)->jump = true;
+    Step(1);
+    EXPECT_GT(controllers.Get(tooLate)->velocity.y, 0.0f);
+}
+
+TEST_F(CharacterControllerTest, SlopeLimitOnTileMap) {
+    TileCollisionMap map;
+    ASSERT_TRUE(map.LoadFromJson(nlohmann::json::parse(R"({
+        "tileSize": 32,
+        "rows": [
+            "..........",
+            "..........",
+            "..........",
+            "..../#####",
+            "##########"
+        ]
+    })")));
+    system.SetTileMap(&map);
+
+    EntityID climber = CreateWalker(80.0f, 128.0f, 1.0f);
+    EntityID blocked = CreateWalker(80.0f, 128.0f, 1.0f);
+    controllers.Get(blocked)->maxSlope = 30.0f;
+    controllers.Get(blocked)->stepHeight = 0.0f;
+
+    Step(45);
+
+    EXPECT_LT(Feet(climber), 96.5f);         // up the 45 degree slope onto the plateau
+    EXPECT_GT(transforms.Get(climber)->position.x, 160.0f);
+    EXPECT_NEAR(Feet(blocked), 128.0f, 0.05f);
+    EXPECT_LT(transforms.Get(blocked)->position.x, 130.0f);
+    EXPECT_TRUE(controllers.Get(blocked)->isGrounded);
+}
+
+TEST_F(CharacterControllerTest, ReportsCollidersItRunsInto) {
+    const EntityID floor = CreateBlock(-200.0f, 400.0f, 800, 40);
+    const EntityID wall = CreateBlock(200.0f, 300.0f, 20, 100);
+    const EntityID walker = CreateWalker(183.0f, 399.9f, 1.0f);
+
+    Step(1);
+
+    // Once per collider even when both axes hit it
+    const auto& contacts = system.GetContacts();
+    ASSERT_EQ(contacts.size(), 2u);
+    EXPECT_EQ(contacts[0], std::make_pair(walker, wall));
+    EXPECT_EQ(contacts[1], std::make_pair(walker, floor));
+
+    // Standing still in open space hits nothing but the floor
+    controllers.Get(walker)->moveX = 0.0f;
+    transforms.Get(walker)->position.x = 0.0f;
+    Step(1);
+    ASSERT_EQ(system.GetContacts().size(), 1u);
+    EXPECT_EQ(system.GetContacts()[0].second, floor);
+}
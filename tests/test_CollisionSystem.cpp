@@ -6,6 +6,7 @@
 #include "systems/EntityCreationSystem.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <vector>
 
 class CollisionSystemTest : public ::testing::Test {
@@ -98,4 +99,127 @@ TEST_F(CollisionSystemTest, DetectsMultipleCollisionsForMultiplePairs) {
     EXPECT_TRUE(HasCollision(a, b));
     EXPECT_TRUE(HasCollision(a, c));
     EXPECT_TRUE(HasCollision(b, c));
-}
\ No newline at end of file
+}
+TEST_F(CollisionSystemTest, SweepFindsThinWallBetweenFrames) {
+    EntityID bullet = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{4, 4, CollisionLayer::Projectile, CollisionLayer::Wall, true}
+    );
+    EntityID wall = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{100.0f, -20.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{2, 40, CollisionLayer::Wall, CollisionLayer::None}
+    );
+
+    system.Update(0.0f);
+
+    SweepHit hit;
+    ASSERT_TRUE(system.Sweep(bullet, VectorFloat{300.0f, 0.0f}, hit));
+    EXPECT_EQ(hit.entity, wall);
+    EXPECT_FLOAT_EQ(hit.toi, 96.0f / 300.0f);
+    EXPECT_FLOAT_EQ(hit.normal.x, -1.0f);
+
+    // Not continuous -> no swept test
+    colliders.Get(bullet)->continuous = false;
+    EXPECT_FALSE(system.Sweep(bullet, VectorFloat{300.0f, 0.0f}, hit));
+}
+
+TEST_F(CollisionSystemTest, NonInteractingLayersNeverPair) {
+    // Pickup only wants the player, wall wants nothing
+    EntityID pickup = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{10, 10, CollisionLayer::Pickup, CollisionLayer::Player}
+    );
+    EntityID wall = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{5.0f, 5.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{10, 10, CollisionLayer::Wall, CollisionLayer::None}
+    );
+    EntityID player = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{2.0f, 2.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{10, 10, CollisionLayer::Player, CollisionLayer::Wall}
+    );
+
+    system.Update(0.0f);
+
+    ASSERT_EQ(system.GetCollisions().size(), 2);
+    EXPECT_TRUE(HasCollision(pickup, player));
+    EXPECT_TRUE(HasCollision(wall, player));
+    EXPECT_FALSE(HasCollision(pickup, wall));
+}
+
+TEST_F(CollisionSystemTest, UsesUpperLayerBits) {
+    const auto water = static_cast<CollisionLayer>(1u << 20);
+    creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{10, 10, water, CollisionLayer::None}
+    );
+    EntityID b = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{70.0f, 70.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{10, 10, CollisionLayer::Player, water}
+    );
+    EntityID c = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{60.0f, 60.0f}, 0.0f, VectorFloat{0.0f, 0.0f} },
+        ColliderComponent{20, 20, water, CollisionLayer::None}
+    );
+
+    system.Update(0.0f);
+
+    // Spans 4 cells, but reported once
+    ASSERT_EQ(system.GetCollisions().size(), 1);
+    EXPECT_TRUE(HasCollision(b, c));
+}
+
+TEST_F(CollisionSystemTest, ParallelNarrowphaseMatchesSerial) {
+    // Dense overlapping field, enough pairs for several chunks
+    for (int i = 0; i < 2000; ++i) {
+        const float x = static_cast<float>((i * 37) % 600);
+        const float y = static_cast<float>((i * 91) % 600);
+        creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{0.0f, 0.0f} },
+            ColliderComponent{24, 24, CollisionLayer::Enemy, CollisionLayer::Enemy}
+        );
+    }
+
+    // Same pair set, independent of cell iteration order
+    auto sortedPairs = [this] {
+        auto pairs = system.GetCollisions();
+        for (auto& [a, b] : pairs) {
+            if (b < a) std::swap(a, b);
+        }
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    };
+
+    system.Update(0.0f);
+    const auto serial = sortedPairs();
+    ASSERT_GT(serial.size(), 2000u);
+
+    JobSystem jobs(3);
+    system.SetJobSystem(&jobs);
+    system.Update(0.0f);
+
+    EXPECT_EQ(sortedPairs(), serial);
+}
+
+TEST(AABBKernelTest, MatchesScalarPath) {
+    const AABB box{ 10.0f, 10.0f, 20.0f, 20.0f };
+
+    AABBLanes lanes;
+    lanes.Push({ 0.0f, 0.0f, 10.0f, 10.0f });    // touches the corner
+    lanes.Push({ 29.5f, 29.5f, 5.0f, 5.0f });    // overlaps by half a pixel
+    lanes.Push({ 30.0f, 15.0f, 5.0f, 5.0f });    // touches the right edge
+    lanes.Push({ 15.0f, 15.0f, 2.0f, 2.0f });    // inside
+    lanes.Push({ 0.0f, 0.0f, 100.0f, 100.0f });  // contains
+    lanes.Push({ -50.0f, 12.0f, 40.0f, 1.0f });  // left of it
+    lanes.Push({ 12.0f, 9.9f, 1.0f, 0.2f });     // crosses the top edge
+
+    const uint32_t expected = 0b1011010;
+    EXPECT_EQ(OverlapMask(box, lanes), expected);
+
+    // The unused lane is zero-filled, not garbage
+    EXPECT_EQ(lanes.minX[AABB_BATCH - 1], 0.0f);
+    EXPECT_EQ(lanes.maxY[AABB_BATCH - 1], 0.0f);
+
+    lanes.Push({ 20.0f, 20.0f, 1.0f, 1.0f });
+    EXPECT_EQ(OverlapMask(box, lanes),
+              OverlapMaskScalar(box, lanes.minX, lanes.minY, lanes.maxX, lanes.maxY));
+}
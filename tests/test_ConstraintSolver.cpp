@@ -0,0 +1,324 @@
+#include <gtest/gtest.h>
+#include "systems/ConstraintSolver.h"
+#include "systems/PhysicsSystem.h"
+#include "systems/CollisionSystem.h"
+#include "systems/EntityCreationSystem.h"
+#include "core/EntityManager.h"
+#include "core/ComponentStorage.h"
+#include "components/TransformComponent.h"
+#include "components/PhysicsComponent.h"
+#include "components/AccelerationComponent.h"
+#include "components/ColliderComponent.h"
+#include "components/JointComponent.h"
+#include "core/JobSystem.h"
+
+#include <vector>
+
+class ConstraintSolverTest : public ::testing::Test {
+protected:
+    EntityManager entityManager;
+    EntityCreationSystem creationSystem{&entityManager};
+
+    ComponentStorage<TransformComponent> transforms;
+    ComponentStorage<PhysicsComponent> physics;
+    ComponentStorage<AccelerationComponent> accelerations;
+    ComponentStorage<ColliderComponent> colliders;
+    ComponentStorage<JointComponent> joints;
+
+    CollisionSystem collisionSystem{entityManager, transforms, colliders};
+    PhysicsSystem physicsSystem{transforms, accelerations, physics};
+    ConstraintSolver solver{transforms, colliders, physics};
+
+    void SetUp() override {
+        creationSystem.RegisterStorage(&transforms);
+        creationSystem.RegisterStorage(&physics);
+        creationSystem.RegisterStorage(&accelerations);
+        creationSystem.RegisterStorage(&colliders);
+        creationSystem.RegisterStorage(&joints);
+
+        collisionSystem.SetPhysics(&physics);
+        physicsSystem.SetCollisionSystem(&collisionSystem);
+        physicsSystem.SetConstraintSolver(&solver);
+        solver.SetJoints(&joints);
+        physicsSystem.SetGravity(900.0f);
+        physicsSystem.SetSleepingEnabled(false);
+    }
+
+    EntityID CreateGround(float y) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{-500.0f, y}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            ColliderComponent{2000, 40, CollisionLayer::Wall, CollisionLayer::All}
+        );
+    }
+
+    EntityID CreateBox(float x, float y, const PhysicsComponent& phys = PhysicsComponent{}) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            phys,
+            ColliderComponent{20, 20, CollisionLayer::Environment, CollisionLayer::All}
+        );
+    }
+
+    EntityID CreateAnchor(float x, float y) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} });
+    }
+
+    EntityID CreateJointed(float x, float y, const JointComponent& joint, const PhysicsComponent& phys = PhysicsComponent{}) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} }, phys, joint);
+    }
+
+    // Chain of 20 px links hanging from `anchor`, each pinned to the bottom of the previous one
+    std::vector<EntityID> CreateChain(EntityID anchor, int count) {
+        std::vector<EntityID> links;
+        EntityID previous = anchor;
+        for (int i = 0; i < count; ++i) {
+            JointComponent pin;
+            pin.type = JointType::Pin;
+            pin.other = previous;
+            pin.anchorB = { 0.0f, i == 0 ? 0.0f : 20.0f };
+
+            previous = CreateJointed(static_cast<float>(i) * 20.0f, 0.0f, pin);  // starts horizontal
+            links.push_back(previous);
+        }
+        return links;
+    }
+
+    float Distance(EntityID a, EntityID b) {
+        return (transforms.Get(b)->position - transforms.Get(a)->position).Length();
+    }
+
+    void Step(int frames) {
+        for (int i = 0; i < frames; ++i) {
+            collisionSystem.Update(1.0f / 60.0f);
+            physicsSystem.Update(1.0f / 60.0f);
+        }
+    }
+};
+
+TEST_F(ConstraintSolverTest, BoxRestsOnGround) {
+    CreateGround(100.0f);
+    EntityID box = CreateBox(0.0f, 40.0f);
+
+    Step(120);
+
+    const auto* t = transforms.Get(box);
+    EXPECT_NEAR(t->position.y, 80.0f, 1.0f);  // within the slop
+    EXPECT_NEAR(physics.Get(box)->velocity.y, 0.0f, 1.0f);
+    EXPECT_TRUE(physics.Get(box)->isGrounded);
+}
+
+TEST_F(ConstraintSolverTest, StackOfFiftyIsStableAtEightIterations) {
+    constexpr int COUNT = 50;
+    solver.SetIterations(8);
+
+    CreateGround(1000.0f);
+    std::vector<EntityID> boxes;
+    for (int i = 0; i < COUNT; ++i) {
+        boxes.push_back(CreateBox(0.0f, 1000.0f - 20.0f * (i + 1)));
+    }
+
+    Step(600);
+
+    // Settled: penetration of each contact stays around the slop, nothing slides sideways
+    for (int i = 0; i < COUNT; ++i) {
+        const auto* t = transforms.Get(boxes[i]);
+        EXPECT_NEAR(t->position.x, 0.0f, 0.01f) << i;
+        EXPECT_LE(t->position.y, 1000.0f - 20.0f * (i + 1) + (i + 1) * 1.0f) << i;
+        EXPECT_NEAR(physics.Get(boxes[i])->velocity.Length(), 0.0f, 1.0f) << i;
+    }
+
+    // Contacts kept their impulses from the previous frame
+    EXPECT_EQ(solver.GetStats().contacts, COUNT);
+    EXPECT_EQ(solver.GetStats().warmStarted, COUNT);
+}
+
+// Acceleration into a wall is added in every substep, so every substep must solve the contact
+TEST_F(ConstraintSolverTest, SubstepsSolveContactsEveryStep) {
+    physicsSystem.SetGravity(0.0f);
+    physicsSystem.SetSubsteps(4);
+
+    for (bool adaptive : { false, true }) {
+        physicsSystem.SetAdaptiveSubsteps(adaptive, 240.0f);
+        const float x = adaptive ? 1000.0f : 0.0f;  // the first pair keeps running
+
+        // Pushed into the wall, sliding along it fast enough to be substepped in adaptive mode
+        creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x + 100.0f, -5000.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            ColliderComponent{40, 10000, CollisionLayer::Wall, CollisionLayer::All});
+
+        PhysicsComponent phys;
+        phys.linearDamping = 0.0f;
+        phys.maxSpeed = 5000.0f;
+        phys.frictionStatic = 0.0f;
+        phys.frictionKinetic = 0.0f;
+        phys.velocity = { 0.0f, 600.0f };
+        const EntityID box = creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x + 80.5f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            phys,
+            AccelerationComponent{ 2000.0f, 0.0f },
+            ColliderComponent{20, 20, CollisionLayer::Environment, CollisionLayer::All});
+
+        Step(60);
+
+        // Held at the wall after the last substep too, not 3 substeps' worth of acceleration into it
+        EXPECT_LE(transforms.Get(box)->position.x, x + 80.5f + 0.25f) << adaptive;
+        EXPECT_NEAR(physics.Get(box)->velocity.x, 0.0f, 5.0f) << adaptive;
+        EXPECT_NEAR(physics.Get(box)->velocity.y, 600.0f, 1e-3f) << adaptive;
+
+    }
+}
+
+TEST_F(ConstraintSolverTest, FrictionStopsSlidingBox) {
+    CreateGround(100.0f);
+
+    PhysicsComponent slider;
+    slider.linearDamping = 0.0f;
+    slider.velocity = {200.0f, 0.0f};
+    EntityID box = CreateBox(0.0f, 80.5f, slider);
+
+    Step(2);
+    const float early = physics.Get(box)->velocity.x;
+    EXPECT_LT(early, 200.0f);
+
+    Step(300);
+    EXPECT_NEAR(physics.Get(box)->velocity.x, 0.0f, 0.5f);
+    EXPECT_GT(transforms.Get(box)->position.x, 0.0f);
+}
+
+TEST_F(ConstraintSolverTest, DistanceJointKeepsLength) {
+    EntityID anchor = CreateAnchor(0.0f, 0.0f);
+
+    JointComponent rod;
+    rod.type = JointType::Distance;
+    rod.other = anchor;
+    rod.length = 100.0f;
+    EntityID bob = CreateJointed(100.0f, 0.0f, rod);  // swings down from horizontal
+
+    for (int i = 0; i < 120; ++i) {
+        Step(1);
+        EXPECT_NEAR(Distance(anchor, bob), 100.0f, 2.0f) << i;
+    }
+    EXPECT_GT(transforms.Get(bob)->position.y, 0.0f);
+}
+
+TEST_F(ConstraintSolverTest, RopeIsSlackUntilTaut) {
+    EntityID anchor = CreateAnchor(0.0f, 0.0f);
+
+    JointComponent rope;
+    rope.type = JointType::Rope;
+    rope.other = anchor;
+    rope.length = 100.0f;
+
+    PhysicsComponent free;
+    free.linearDamping = 0.0f;
+    EntityID bob = CreateJointed(0.0f, 10.0f, rope, free);
+
+    // Free fall while slack
+    Step(5);
+    EXPECT_EQ(solver.GetStats().joints, 0u);
+    EXPECT_GT(physics.Get(bob)->velocity.y, 60.0f);
+
+    Step(120);
+    EXPECT_EQ(solver.GetStats().joints, 1u);
+    EXPECT_NEAR(Distance(anchor, bob), 100.0f, 2.0f);
+}
+
+TEST_F(ConstraintSolverTest, SpringSettlesAtRestLength) {
+    physicsSystem.SetGravity(0.0f);
+    EntityID anchor = CreateAnchor(0.0f, 0.0f);
+
+    JointComponent spring;
+    spring.type = JointType::Spring;
+    spring.other = anchor;
+    spring.length = 100.0f;
+    spring.stiffness = 50.0f;
+    spring.damping = 5.0f;
+    EntityID bob = CreateJointed(150.0f, 0.0f, spring);
+
+    Step(10);
+    EXPECT_LT(Distance(anchor, bob), 150.0f);  // pulled in, not snapped
+
+    Step(600);
+    EXPECT_NEAR(Distance(anchor, bob), 100.0f, 1.0f);
+}
+
+TEST_F(ConstraintSolverTest, PinnedChainHangsTogether) {
+    EntityID anchor = CreateAnchor(0.0f, 0.0f);
+    std::vector<EntityID> links = CreateChain(anchor, 10);
+
+    Step(300);
+
+    EXPECT_NEAR(Distance(anchor, links[0]), 0.0f, 1.0f);
+    for (size_t i = 1; i < links.size(); ++i) {
+        const VectorFloat bottom = transforms.Get(links[i - 1])->position + VectorFloat{0.0f, 20.0f};
+        EXPECT_NEAR((transforms.Get(links[i])->position - bottom).Length(), 0.0f, 1.0f) << i;
+    }
+    EXPECT_GT(transforms.Get(links.back())->position.y, 150.0f);  // swung down
+}
+
+TEST_F(ConstraintSolverTest, ColoredBatchesAreThreadCountIndependent) {
+    EntityID anchor = CreateAnchor(0.0f, 0.0f);
+    std::vector<EntityID> links = CreateChain(anchor, 400);
+
+    solver.SetGraphColoring(true);
+    Step(1);
+    EXPECT_EQ(solver.GetStats().colors, 2u);  // a chain alternates two colours
+
+    // Same scene solved again on 4 threads
+    std::vector<VectorFloat> serial;
+    Step(30);
+    for (EntityID id : links) serial.push_back(transforms.Get(id)->position);
+
+    for (size_t i = 0; i < links.size(); ++i) {
+        transforms.Get(links[i])->position = { static_cast<float>(i) * 20.0f, 0.0f };
+        physics.Get(links[i])->velocity = {0.0f, 0.0f};
+        joints.Get(links[i])->impulse = {0.0f, 0.0f};
+    }
+    JobSystem jobs(3);
+    solver.SetJobSystem(&jobs);
+    Step(31);
+
+    for (size_t i = 0; i < links.size(); ++i) {
+        EXPECT_EQ(transforms.Get(links[i])->position.x, serial[i].x) << i;
+        EXPECT_EQ(transforms.Get(links[i])->position.y, serial[i].y) << i;
+    }
+}
+
+TEST_F(ConstraintSolverTest, IslandsMatchSerialSolveOnAnyThreadCount) {
+    CreateGround(400.0f);
+
+    // 40 separate piles of 3 boxes - one island each (the static ground doesn't link them)
+    std::vector<EntityID> boxes;
+    for (int pile = 0; pile < 40; ++pile) {
+        for (int level = 0; level < 3; ++level) {
+            boxes.push_back(CreateBox(-480.0f + pile * 45.0f, 378.0f - level * 21.0f));
+        }
+    }
+    std::vector<VectorFloat> start;
+    for (EntityID id : boxes) start.push_back(transforms.Get(id)->position);
+
+    Step(60);
+    std::vector<VectorFloat> serial;
+    for (EntityID id : boxes) serial.push_back(transforms.Get(id)->position);
+
+    // Same scene again, island by island on 4 threads
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        transforms.Get(boxes[i])->position = start[i];
+        *physics.Get(boxes[i]) = PhysicsComponent{};
+    }
+    solver.SetWarmStarting(false);
+    solver.SetWarmStarting(true);
+
+    JobSystem jobs(3);
+    solver.SetJobSystem(&jobs);
+    solver.SetIslandSolving(true);
+    Step(60);
+
+    EXPECT_EQ(solver.GetStats().islands, 40u);
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        EXPECT_EQ(transforms.Get(boxes[i])->position.x, serial[i].x) << i;
+        EXPECT_EQ(transforms.Get(boxes[i])->position.y, serial[i].y) << i;
+    }
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include "systems/PhysicsSystem.h"
+#include "systems/MovementSystem.h"
+#include "systems/CollisionSystem.h"
+#include "systems/ConstraintSolver.h"
+#include "systems/EntityCreationSystem.h"
+#include "core/EntityManager.h"
+#include "core/ComponentStorage.h"
+#include "components/TransformComponent.h"
+#include "components/VelocityComponent.h"
+#include "components/AccelerationComponent.h"
+#include "components/PhysicsComponent.h"
+#include "components/ColliderComponent.h"
+#include "components/JointComponent.h"
+#include "utils/Fixed.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*
+    Recorded scenario for lockstep / replay validation. CMake builds this file twice,
+    at -O0 and -O2, in ENGINE_FIXED_POINT mode; both must reach the recorded state hash.
+*/
+namespace {
+    constexpr uint64_t RECORDED_HASH = 0x418b97af2e55829aull;
+
+    // Input recorded from a play session: frame -> impulse on one body
+    struct RecordedInput {
+        int frame;
+        size_t body;
+        float ix, iy;
+    };
+
+    const RecordedInput RECORDING[] = {
+        { 10, 3, 120.0f, -300.0f },
+        { 45, 7, -80.0f, -500.0f },
+        { 90, 0, 200.0f, 0.0f },
+        { 91, 0, 200.0f, 0.0f },
+        { 150, 12, 0.0f, -800.0f },
+        { 220, 5, -150.0f, -150.0f },
+    };
+
+    // Fixed LCG - std distributions may differ between standard libraries
+    struct Lcg {
+        uint32_t state;
+        float Next(float lo, float hi) {
+            state = state * 1664525u + 1013904223u;
+            return lo + (hi - lo) * static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+        }
+    };
+
+    void HashBytes(uint64_t& hash, const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;  // FNV-1a
+        }
+    }
+}
+
+class DeterminismTest : public ::testing::Test {
+protected:
+    EntityManager entityManager;
+    EntityCreationSystem creationSystem{&entityManager};
+
+    ComponentStorage<TransformComponent> transforms;
+    ComponentStorage<VelocityComponent> velocities;
+    ComponentStorage<AccelerationComponent> accelerations;
+    ComponentStorage<PhysicsComponent> physics;
+    ComponentStorage<ColliderComponent> colliders;
+    ComponentStorage<JointComponent> joints;
+
+    void SetUp() override {
+        creationSystem.RegisterStorage(&transforms);
+        creationSystem.RegisterStorage(&velocities);
+        creationSystem.RegisterStorage(&accelerations);
+        creationSystem.RegisterStorage(&physics);
+        creationSystem.RegisterStorage(&colliders);
+        creationSystem.RegisterStorage(&joints);
+    }
+
+    uint64_t StateHash() {
+        std::vector<EntityID> ids;
+        for (const auto& [id, t] : transforms.GetAll()) ids.push_back(id);
+        std::sort(ids.begin(), ids.end());
+
+        uint64_t hash = 14695981039346656037ull;
+        for (EntityID id : ids) {
+            HashBytes(hash, &transforms.Get(id)->position, sizeof(VectorFloat));
+            if (const auto* p = physics.Get(id)) HashBytes(hash, &p->velocity, sizeof(VectorFloat));
+            if (const auto* v = velocities.Get(id)) HashBytes(hash, v, sizeof(VelocityComponent));
+        }
+        return hash;
+    }
+};
+
+TEST_F(DeterminismTest, RecordedScenarioHash) {
+#if !defined(ENGINE_FIXED_POINT)
+    // The hash was recorded with the Q16.16 build; float results depend on the compiler
+    GTEST_SKIP() << "needs ENGINE_FIXED_POINT";
+#endif
+    Lcg rng{12345u};
+
+    // Ground and two walls
+    creationSystem.CreateEntityWith(TransformComponent{ VectorFloat{-100.0f, 600.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+                                    ColliderComponent{1000, 40, CollisionLayer::Wall, CollisionLayer::All});
+    creationSystem.CreateEntityWith(TransformComponent{ VectorFloat{-140.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+                                    ColliderComponent{40, 640, CollisionLayer::Wall, CollisionLayer::All});
+    creationSystem.CreateEntityWith(TransformComponent{ VectorFloat{900.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+                                    ColliderComponent{40, 640, CollisionLayer::Wall, CollisionLayer::All});
+
+    // Falling boxes
+    std::vector<EntityID> bodies;
+    for (int i = 0; i < 30; ++i) {
+        PhysicsComponent phys;
+        phys.SetMass(rng.Next(0.5f, 3.0f));
+        phys.velocity = { rng.Next(-100.0f, 100.0f), rng.Next(-50.0f, 50.0f) };
+        const int size = 12 + static_cast<int>(rng.Next(0.0f, 20.0f));
+
+        bodies.push_back(creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{ rng.Next(0.0f, 800.0f), rng.Next(0.0f, 400.0f) }, 0.0f, VectorFloat{1.0f, 1.0f} },
+            phys,
+            AccelerationComponent{ rng.Next(-20.0f, 20.0f), 0.0f },
+            ColliderComponent{ size, size, CollisionLayer::Environment, CollisionLayer::All }));
+    }
+
+    // Hanging chain
+    EntityID previous = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{400.0f, 50.0f}, 0.0f, VectorFloat{1.0f, 1.0f} });
+    for (int i = 0; i < 6; ++i) {
+        JointComponent rope;
+        rope.type = i % 2 ? JointType::Rope : JointType::Distance;
+        rope.other = previous;
+        rope.length = 24.0f;
+        previous = creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{400.0f + 24.0f * (i + 1), 50.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            PhysicsComponent{}, rope);
+    }
+
+    // Kinematic movers
+    for (int i = 0; i < 8; ++i) {
+        creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{ rng.Next(0.0f, 800.0f), rng.Next(0.0f, 400.0f) }, 0.0f, VectorFloat{1.0f, 1.0f} },
+            VelocityComponent{ rng.Next(-60.0f, 60.0f), rng.Next(-60.0f, 60.0f) },
+            AccelerationComponent{ rng.Next(-5.0f, 5.0f), rng.Next(-5.0f, 5.0f) });
+    }
+
+    CollisionSystem collisionSystem(entityManager, transforms, colliders);
+    ConstraintSolver solver(transforms, colliders, physics);
+    PhysicsSystem physicsSystem(transforms, accelerations, physics);
+    MovementSystem movementSystem(transforms, velocities, accelerations, physics);
+
+    collisionSystem.SetPhysics(&physics);
+    solver.SetJoints(&joints);
+    physicsSystem.SetGravity(900.0f);
+    physicsSystem.SetCollisionSystem(&collisionSystem);
+    physicsSystem.SetConstraintSolver(&solver);
+    physicsSystem.SetSubsteps(4);
+    physicsSystem.SetAdaptiveSubsteps(true, 300.0f);
+
+    const float dt = 1.0f / 60.0f;
+    for (int frame = 0; frame < 300; ++frame) {
+        for (const RecordedInput& input : RECORDING) {
+            if (input.frame != frame) continue;
+            auto* phys = physics.Get(bodies[input.body]);
+            phys->impulse.x += input.ix;
+            phys->impulse.y += input.iy;
+        }
+
+        movementSystem.Update(dt);
+        collisionSystem.Update(dt);
+        physicsSystem.Update(dt);
+    }
+
+    // Every compiler / optimisation level must reproduce it
+    EXPECT_EQ(StateHash(), RECORDED_HASH);
+}
+
+TEST(FixedTest, ArithmeticIsExactAndSaturates) {
+    const Fixed a(1.5f), b(-2.25f);
+    EXPECT_EQ((a + b).Raw(), Fixed(-0.75f).Raw());
+    EXPECT_EQ((a * b).Raw(), Fixed(-3.375f).Raw());
+    EXPECT_EQ((b / a).Raw(), Fixed(-1.5f).Raw());
+    EXPECT_FLOAT_EQ(static_cast<float>(Fixed(9.81f)), static_cast<float>(Fixed::FromRaw(642908)));
+
+    // Rounding is symmetric around zero
+    const Fixed tiny = Fixed::FromRaw(1);
+    EXPECT_EQ((tiny * Fixed(0.5f)).Raw(), 1);
+    EXPECT_EQ((-tiny * Fixed(0.5f)).Raw(), -1);
+
+    EXPECT_EQ((Fixed(30000) + Fixed(30000)).Raw(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ((Fixed(-1) / Fixed{}).Raw(), std::numeric_limits<int32_t>::min());
+}
+
+TEST(FixedTest, SqrtAndLengthAreDeterministic) {
+    EXPECT_EQ(Sqrt(Fixed(16)).Raw(), Fixed(4).Raw());
+    EXPECT_EQ(Sqrt(Fixed(2.0f)).Raw(), 92681);  // floor(sqrt(2) * 65536)
+    EXPECT_EQ(Sqrt(Fixed(-1)).Raw(), 0);
+
+    // Would overflow as x * x + y * y in Q16.16
+    EXPECT_EQ(Length(Fixed(3000), Fixed(4000)).Raw(), Fixed(5000).Raw());
+
+    Fixed x(300), y(-400);
+    Normalize(x, y);
+    EXPECT_EQ(x.Raw(), 39321);   // 0.6, division truncates
+    EXPECT_EQ(y.Raw(), -52428);  // -0.8
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include "systems/ForceFields.h"
+#include "systems/PhysicsSystem.h"
+#include "systems/EntityCreationSystem.h"
+#include "core/EntityManager.h"
+#include "core/ComponentStorage.h"
+#include "components/TransformComponent.h"
+#include "components/PhysicsComponent.h"
+#include "components/AccelerationComponent.h"
+#include "components/ForceFieldComponent.h"
+#include "level_manager/LevelData.h"
+
+class ForceFieldsTest : public ::testing::Test {
+protected:
+    EntityManager entityManager;
+    EntityCreationSystem creationSystem{&entityManager};
+
+    ComponentStorage<TransformComponent> transforms;
+    ComponentStorage<PhysicsComponent> physics;
+    ComponentStorage<AccelerationComponent> accelerations;
+    ComponentStorage<ForceFieldComponent> fields;
+
+    PhysicsSystem physicsSystem{transforms, accelerations, physics};
+    ForceFields forceFields{transforms, fields};
+
+    void SetUp() override {
+        creationSystem.RegisterStorage(&transforms);
+        creationSystem.RegisterStorage(&physics);
+        creationSystem.RegisterStorage(&accelerations);
+        creationSystem.RegisterStorage(&fields);
+
+        physicsSystem.SetGravity(0.0f);
+        physicsSystem.SetSleepingEnabled(false);
+        physicsSystem.SetForceFields(&forceFields);
+    }
+
+    EntityID CreateField(float x, float y, const ForceFieldComponent& field) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            field
+        );
+    }
+
+    EntityID CreateBody(float x, float y) {
+        PhysicsComponent phys;
+        phys.linearDamping = 0.0f;
+        phys.maxSpeed = 10000.0f;
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            phys
+        );
+    }
+};
+
+TEST_F(ForceFieldsTest, UniformFieldOnlyAffectsBodiesInside) {
+    ForceFieldComponent wind;
+    wind.width = 200.0f;
+    wind.height = 200.0f;
+    wind.direction = { 60.0f, 0.0f };
+    CreateField(0.0f, 0.0f, wind);
+
+    const EntityID inside = CreateBody(100.0f, 100.0f);
+    const EntityID outside = CreateBody(500.0f, 100.0f);
+
+    const float dt = 1.0f / 60.0f;
+    physicsSystem.Update(dt);
+
+    EXPECT_NEAR(physics.Get(inside)->velocity.x, 60.0f * dt, 1e-3f);
+    EXPECT_FLOAT_EQ(physics.Get(outside)->velocity.x, 0.0f);
+    EXPECT_EQ(forceFields.GetStats().bodiesInside, 1u);
+}
+
+TEST_F(ForceFieldsTest, RadialVortexAndDragDirections) {
+    ForceFieldComponent radial;
+    radial.type = ForceFieldType::Radial;
+    radial.width = 200.0f;
+    radial.height = 200.0f;
+    radial.strength = 100.0f;
+    radial.falloff = false;
+    CreateField(0.0f, 0.0f, radial);
+
+    ForceFieldComponent vortex = radial;
+    vortex.type = ForceFieldType::Vortex;
+    CreateField(1000.0f, 0.0f, vortex);
+
+    ForceFieldComponent drag;
+    drag.type = ForceFieldType::Drag;
+    drag.width = 200.0f;
+    drag.height = 200.0f;
+    drag.direction = { 0.0f, 50.0f };
+    drag.strength = 2.0f;
+    CreateField(2000.0f, 0.0f, drag);
+
+    // Right of the centre: pushed right / turned clockwise (down on screen)
+    const VectorFloat out = forceFields.Sample({ 150.0f, 100.0f }, {}, 1.0f / 60.0f);
+    EXPECT_FLOAT_EQ(out.x, 100.0f);
+    EXPECT_FLOAT_EQ(out.y, 0.0f);
+
+    const VectorFloat turn = forceFields.Sample({ 1150.0f, 100.0f }, {}, 1.0f / 60.0f);
+    EXPECT_FLOAT_EQ(turn.x, 0.0f);
+    EXPECT_FLOAT_EQ(turn.y, 100.0f);
+
+    // Drag pulls towards the flow velocity
+    const VectorFloat pull = forceFields.Sample({ 2100.0f, 100.0f }, { 20.0f, 50.0f }, 1.0f / 60.0f);
+    EXPECT_FLOAT_EQ(pull.x, -40.0f);
+    EXPECT_FLOAT_EQ(pull.y, 0.0f);
+}
+
+TEST_F(ForceFieldsTest, CostScalesWithBodiesInsideFields) {
+    for (int i = 0; i < 50; ++i) {
+        ForceFieldComponent field;
+        field.width = 100.0f;
+        field.height = 100.0f;
+        field.direction = { 0.0f, -10.0f };
+        CreateField(i * 1000.0f, 0.0f, field);
+    }
+
+    // 1000 bodies, 10 of them inside the first field
+    for (int i = 0; i < 1000; ++i) {
+        CreateBody(i < 10 ? 10.0f + i : 50.0f + i * 40.0f, i < 10 ? 10.0f : 500.0f);
+    }
+
+    physicsSystem.Update(1.0f / 60.0f);
+
+    EXPECT_EQ(forceFields.GetStats().fields, 50u);
+    EXPECT_EQ(forceFields.GetStats().bodiesInside, 10u);
+    EXPECT_EQ(forceFields.GetStats().evaluations, 10u);
+}
+
+TEST_F(ForceFieldsTest, LevelWindAndGravityAreTheDefaultField) {
+    LevelData level;
+    level.gravity = 100.0f;
+    level.ambientWindX = 30.0f;
+    physicsSystem.ApplyLevel(level);
+
+    const EntityID body = CreateBody(0.0f, 0.0f);
+
+    const float dt = 1.0f / 60.0f;
+    physicsSystem.Update(dt);
+
+    EXPECT_NEAR(physics.Get(body)->velocity.x, 30.0f * dt, 1e-3f);
+    EXPECT_NEAR(physics.Get(body)->velocity.y, 100.0f * dt, 1e-3f);
+}
+
+TEST_F(ForceFieldsTest, MovedEditedAndSwappedFieldsAreSeen) {
+    ForceFieldComponent wind;
+    wind.width = 100.0f;
+    wind.height = 100.0f;
+    wind.direction = { 50.0f, 0.0f };
+    const EntityID field = CreateField(0.0f, 0.0f, wind);
+
+    const VectorFloat point{ 250.0f, 50.0f };
+    EXPECT_FLOAT_EQ(forceFields.Sample(point, {}, 0.0f).x, 0.0f);
+
+    // Moved over the point, no InvalidateFields()
+    transforms.Get(field)->position = { 200.0f, 0.0f };
+    EXPECT_FLOAT_EQ(forceFields.Sample(point, {}, 0.0f).x, 50.0f);
+
+    // Edited in place
+    fields.Get(field)->direction = { 80.0f, 0.0f };
+    EXPECT_FLOAT_EQ(forceFields.Sample(point, {}, 0.0f).x, 80.0f);
+
+    // One field out, another in - same count
+    fields.Remove(field);
+    transforms.Remove(field);
+    wind.direction = { -20.0f, 0.0f };
+    CreateField(200.0f, 0.0f, wind);
+    EXPECT_FLOAT_EQ(forceFields.Sample(point, {}, 0.0f).x, -20.0f);
+    EXPECT_EQ(forceFields.GetStats().fields, 1u);
+}
@@ -49,6 +49,13 @@ TEST_F(MovementSystemTest, MovesEntityWithoutPhysics) {
     ASSERT_NE(transform, nullptr);
     ASSERT_NE(velocity, nullptr);
 
+#if defined(ENGINE_FIXED_POINT)
+    // Q16.16: dt = 1/60 itself is rounded by ~4e-6
+    EXPECT_NEAR(velocity->dx, 10.0f * dt, 1e-4f);
+    EXPECT_NEAR(velocity->dy, 5.0f * dt, 1e-4f);
+    EXPECT_NEAR(transform->position.x, (10.0f * dt) * dt, 1e-4f);
+    EXPECT_NEAR(transform->position.y, (5.0f * dt) * dt, 1e-4f);
+#else
     // Velocity updated
     EXPECT_FLOAT_EQ(velocity->dx, 10.0f * dt);
     EXPECT_FLOAT_EQ(velocity->dy, 5.0f * dt);
@@ -56,6 +63,7 @@ TEST_F(MovementSystemTest, MovesEntityWithoutPhysics) {
     // Transform updated
     EXPECT_FLOAT_EQ(transform->position.x, (10.0f * dt) * dt);
     EXPECT_FLOAT_EQ(transform->position.y, (5.0f * dt) * dt);
+#endif
 }
 
 TEST_F(MovementSystemTest, DoesNotAffectEntityWithPhysics) {
@@ -84,3 +92,31 @@ TEST_F(MovementSystemTest, DoesNotAffectEntityWithPhysics) {
     EXPECT_FLOAT_EQ(transform->position.x, 0.0f);
     EXPECT_FLOAT_EQ(transform->position.y, 0.0f);
 }
+
+TEST_F(MovementSystemTest, FollowsComponentsAddedAndRemovedBetweenUpdates) {
+    MovementSystem system(transforms, velocities, accelerations, physics);
+    system.Update(1.0f);
+
+    // Created after the first Update
+    EntityID entity = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{64.0f, 64.0f} },
+        VelocityComponent{4.0f, 0.0f}
+    );
+    system.Update(1.0f);
+    EXPECT_FLOAT_EQ(transforms.Get(entity)->position.x, 4.0f);
+
+    // Becomes a physics body - the PhysicsSystem owns it now
+    physics.Add(entity, PhysicsComponent{});
+    system.Update(1.0f);
+    EXPECT_FLOAT_EQ(transforms.Get(entity)->position.x, 4.0f);
+
+    // Back to kinematic
+    physics.Remove(entity);
+    system.Update(1.0f);
+    EXPECT_FLOAT_EQ(transforms.Get(entity)->position.x, 8.0f);
+
+    // Destroyed - nothing left pointing at its components
+    entityManager.DestroyEntityFromList(entity);
+    system.Update(1.0f);
+    EXPECT_EQ(transforms.Get(entity), nullptr);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <SDL2/SDL.h>
+#include "systems/ParticleSystem.h"
+#include "graphics/Texture.h"
+
+class ParticleTexture : public Texture {
+public:
+    explicit ParticleTexture(SDL_Texture* tex) : m_texture(tex) {}
+    SDL_Texture* GetSDLTexture() const override { return m_texture; }
+
+private:
+    SDL_Texture* m_texture;
+};
+
+// Records every geometry batch
+class GeometryRenderer : public IRenderer {
+public:
+    struct Batch {
+        SDL_Texture* texture;
+        int vertices;
+        int indices;
+    };
+    std::vector<Batch> batches;
+    std::vector<SDL_Vertex> lastVertices;
+
+    void DrawTexture(SDL_Texture*, const SDL_Rect*, const SDL_Rect*) override {}
+
+    void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                      const int*, int numIndices) override {
+        batches.push_back({ texture, numVertices, numIndices });
+        lastVertices.assign(vertices, vertices + numVertices);
+    }
+
+    void DrawLine(int, int, int, int, SDL_Color) override {}
+};
+
+class ParticleSystemTest : public ::testing::Test {
+protected:
+    ParticleSystem particles;
+    GeometryRenderer renderer;
+
+    ParticleTexture smoke{reinterpret_cast<SDL_Texture*>(0x1)};
+    ParticleTexture spark{reinterpret_cast<SDL_Texture*>(0x2)};
+
+    ParticleEmitterConfig Fixed(float lifetime, float speed, float direction) {
+        ParticleEmitterConfig config;
+        config.lifetimeMin = config.lifetimeMax = lifetime;
+        config.speedMin = config.speedMax = speed;
+        config.direction = direction;
+        config.spread = 0.0f;
+        return config;
+    }
+};
+
+TEST_F(ParticleSystemTest, BurstStopsAtCapacity) {
+    ParticleEmitterConfig config = Fixed(1.0f, 10.0f, 0.0f);
+    config.capacity = 100;
+    const ParticleEmitterID emitter = particles.CreateEmitter(config, {0.0f, 0.0f});
+
+    particles.Burst(emitter, 60);
+    particles.Burst(emitter, 60);
+    EXPECT_EQ(particles.GetParticleCount(emitter), 100u);
+}
+
+TEST_F(ParticleSystemTest, IntegratesVelocityAndGravity) {
+    ParticleEmitterConfig config = Fixed(10.0f, 100.0f, 0.0f);  // moving right
+    config.gravity = {0.0f, 50.0f};
+    const ParticleEmitterID emitter = particles.CreateEmitter(config, {10.0f, 20.0f});
+    particles.Burst(emitter, 13);  // not a multiple of the SIMD width
+
+    const float dt = 0.1f;
+    for (int i = 0; i < 5; ++i) particles.Update(dt);
+
+    const ParticlePool* pool = particles.GetPool(emitter);
+    ASSERT_NE(pool, nullptr);
+    ASSERT_EQ(pool->count, 13u);
+
+    // Semi-implicit Euler: y = sum of (k * g * dt) * dt for k = 1..5
+    for (size_t i = 0; i < pool->count; ++i) {
+        EXPECT_NEAR(pool->x[i], 10.0f + 100.0f * 0.5f, 1e-3f);
+        EXPECT_NEAR(pool->vy[i], 25.0f, 1e-3f);
+        EXPECT_NEAR(pool->y[i], 20.0f + 50.0f * dt * dt * 15.0f, 1e-3f);
+    }
+}
+
+TEST_F(ParticleSystemTest, DeadParticlesAreSwapRemoved) {
+    const ParticleEmitterID emitter = particles.CreateEmitter(Fixed(0.25f, 0.0f, 0.0f), {0.0f, 0.0f});
+    particles.Burst(emitter, 10);
+    particles.Update(0.1f);
+
+    ParticleEmitterConfig longer = Fixed(1.0f, 0.0f, 0.0f);
+    const ParticleEmitterID other = particles.CreateEmitter(longer, {0.0f, 0.0f});
+    particles.Burst(other, 5);
+
+    particles.Update(0.1f);
+    EXPECT_EQ(particles.GetParticleCount(emitter), 10u);
+
+    particles.Update(0.1f);  // 0.3s > 0.25s
+    EXPECT_EQ(particles.GetParticleCount(emitter), 0u);
+    EXPECT_EQ(particles.GetParticleCount(other), 5u);
+    EXPECT_EQ(particles.GetStats().particles, 5u);
+
+    // Survivors keep fading towards endAlpha
+    const ParticlePool* pool = particles.GetPool(other);
+    EXPECT_NEAR(pool->alpha[0], 0.8f, 1e-4f);
+}
+
+TEST_F(ParticleSystemTest, SteadyRateCarriesFractions) {
+    ParticleEmitterConfig config = Fixed(100.0f, 0.0f, 0.0f);
+    config.rate = 25.0f;  // 0.25 per 10ms frame
+    const ParticleEmitterID emitter = particles.CreateEmitter(config, {0.0f, 0.0f});
+
+    for (int i = 0; i < 100; ++i) particles.Update(0.01f);
+    EXPECT_NEAR(static_cast<float>(particles.GetParticleCount(emitter)), 25.0f, 1.0f);
+
+    particles.SetEmitting(emitter, false);
+    for (int i = 0; i < 100; ++i) particles.Update(0.01f);
+    EXPECT_NEAR(static_cast<float>(particles.GetParticleCount(emitter)), 25.0f, 1.0f);
+}
+
+TEST_F(ParticleSystemTest, OneDrawCallPerTexture) {
+    ParticleEmitterConfig smokeConfig = Fixed(1.0f, 0.0f, 0.0f);
+    smokeConfig.texture = &smoke;
+    ParticleEmitterConfig sparkConfig = Fixed(1.0f, 0.0f, 0.0f);
+    sparkConfig.texture = &spark;
+
+    // Interleaved textures still batch into two calls
+    particles.Burst(particles.CreateEmitter(smokeConfig, {0.0f, 0.0f}), 10);
+    particles.Burst(particles.CreateEmitter(sparkConfig, {0.0f, 0.0f}), 20);
+    particles.Burst(particles.CreateEmitter(smokeConfig, {0.0f, 0.0f}), 30);
+    particles.Update(0.016f);
+
+    particles.Draw(&renderer, {0, 0}, 1.0f);
+
+    ASSERT_EQ(renderer.batches.size(), 2u);
+    int smokeQuads = 0, sparkQuads = 0;
+    for (const auto& batch : renderer.batches) {
+        EXPECT_EQ(batch.indices, batch.vertices / 4 * 6);
+        if (batch.texture == smoke.GetSDLTexture()) smokeQuads = batch.vertices / 4;
+        if (batch.texture == spark.GetSDLTexture()) sparkQuads = batch.vertices / 4;
+    }
+    EXPECT_EQ(smokeQuads, 40);
+    EXPECT_EQ(sparkQuads, 20);
+    EXPECT_EQ(particles.GetStats().drawCalls, 2u);
+}
+
+TEST_F(ParticleSystemTest, QuadsFollowCameraAndZoom) {
+    ParticleEmitterConfig config = Fixed(1.0f, 0.0f, 0.0f);
+    config.startSize = config.endSize = 10.0f;
+    config.startAlpha = config.endAlpha = 1.0f;
+    particles.Burst(particles.CreateEmitter(config, {100.0f, 50.0f}), 1);
+
+    particles.Draw(&renderer, {20, 10}, 2.0f);
+
+    ASSERT_EQ(renderer.lastVertices.size(), 4u);
+    EXPECT_FLOAT_EQ(renderer.lastVertices[0].position.x, (100.0f - 20.0f - 5.0f) * 2.0f);
+    EXPECT_FLOAT_EQ(renderer.lastVertices[0].position.y, (50.0f - 10.0f - 5.0f) * 2.0f);
+    EXPECT_FLOAT_EQ(renderer.lastVertices[2].position.x, (100.0f - 20.0f + 5.0f) * 2.0f);
+    EXPECT_EQ(renderer.lastVertices[0].color.a, 255);
+}
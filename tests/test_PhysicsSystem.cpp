@@ -1,11 +1,16 @@
 #include <gtest/gtest.h>
 #include "systems/PhysicsSystem.h"
+#include "systems/CollisionSystem.h"
 #include "core/EntityManager.h"
 #include "systems/EntityCreationSystem.h"
 #include "core/ComponentStorage.h"
 #include "components/TransformComponent.h"
 #include "components/PhysicsComponent.h"
 #include "components/AccelerationComponent.h"
+#include "components/ColliderComponent.h"
+#include "utils/IntegratorKernel.h"
+
+#include <random>
 
 class PhysicsSystemTest : public ::testing::Test {
 protected:
@@ -59,3 +64,190 @@ TEST_F(PhysicsSystemTest, DoesPhysicsAffectTransform) {
     EXPECT_FLOAT_EQ(transform->position.y, 9.81f);
 }
 
+TEST_F(PhysicsSystemTest, ContinuousColliderDoesNotTunnelThroughThinWall) {
+    ComponentStorage<ColliderComponent> colliders;
+    creationSystem.RegisterStorage(&colliders);
+
+    PhysicsComponent bulletPhys;
+    bulletPhys.gravityScale = 0.0f;
+    bulletPhys.linearDamping = 0.0f;
+    bulletPhys.maxSpeed = 5000.0f;
+    bulletPhys.velocity = {3000.0f, 0.0f};  // 50 px per frame at 60 Hz
+
+    EntityID bullet = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+        bulletPhys,
+        ColliderComponent{4, 4, CollisionLayer::Projectile, CollisionLayer::Wall, true}
+    );
+    EntityID wall = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{30.0f, -20.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+        ColliderComponent{2, 40, CollisionLayer::Wall, CollisionLayer::None}
+    );
+
+    CollisionSystem collisionSystem(entityManager, transforms, colliders);
+    PhysicsSystem system(transforms, accelerations, physics);
+    system.SetCollisionSystem(&collisionSystem);
+
+    collisionSystem.Update(1.0f / 60.0f);
+    system.Update(1.0f / 60.0f);
+
+    // Stopped at the wall's left face, velocity into the wall removed
+    EXPECT_FLOAT_EQ(transforms.Get(bullet)->position.x, 26.0f);
+    EXPECT_FLOAT_EQ(physics.Get(bullet)->velocity.x, 0.0f);
+
+    ASSERT_EQ(collisionSystem.GetSweptContacts().size(), 1);
+    EXPECT_EQ(collisionSystem.GetSweptContacts()[0].second, wall);
+
+    // A later broadphase pass doesn't drop the swept contact
+    collisionSystem.Update(1.0f / 60.0f);
+    EXPECT_EQ(collisionSystem.GetSweptContacts().size(), 1);
+}
+
+TEST_F(PhysicsSystemTest, RestingBodyFallsAsleepAndWakesOnImpulse) {
+    PhysicsComponent crate;
+    crate.gravityScale = 0.0f;
+
+    EntityID id = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{10.0f, 10.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+        crate
+    );
+
+    PhysicsSystem system(transforms, accelerations, physics);
+    system.SetSleepThreshold(1.0f, 3);
+
+    for (int i = 0; i < 4; ++i) system.Update(1.0f / 60.0f);
+    ASSERT_TRUE(physics.Get(id)->isSleeping);
+
+    // Forces on a sleeping body are kept until it wakes
+    physics.Get(id)->impulse = {60.0f, 0.0f};
+    system.Update(1.0f);
+
+    EXPECT_FALSE(physics.Get(id)->isSleeping);
+    EXPECT_GT(transforms.Get(id)->position.x, 10.0f);
+}
+
+TEST_F(PhysicsSystemTest, ContactIslandWakesTogether) {
+    ComponentStorage<ColliderComponent> colliders;
+    creationSystem.RegisterStorage(&colliders);
+
+    PhysicsComponent crate;
+    crate.gravityScale = 0.0f;
+
+    // Stack of two touching crates
+    EntityID bottom = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 20.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+        crate,
+        ColliderComponent{20, 20, CollisionLayer::Environment, CollisionLayer::Environment}
+    );
+    EntityID top = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 1.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+        crate,
+        ColliderComponent{20, 20, CollisionLayer::Environment, CollisionLayer::Environment}
+    );
+
+    CollisionSystem collisionSystem(entityManager, transforms, colliders);
+    collisionSystem.SetPhysics(&physics);
+    PhysicsSystem system(transforms, accelerations, physics);
+    system.SetCollisionSystem(&collisionSystem);
+    system.SetSleepThreshold(1.0f, 3);
+
+    for (int i = 0; i < 4; ++i) {
+        collisionSystem.Update(1.0f / 60.0f);
+        system.Update(1.0f / 60.0f);
+    }
+    ASSERT_TRUE(physics.Get(bottom)->isSleeping);
+    ASSERT_TRUE(physics.Get(top)->isSleeping);
+
+    // Sleeping pairs aren't tested
+    collisionSystem.Update(1.0f / 60.0f);
+    EXPECT_TRUE(collisionSystem.GetCollisions().empty());
+    EXPECT_FALSE(collisionSystem.GetStaticGrid().GetAllCells().empty());
+
+    // Kick the top crate - the bottom one wakes with it once they touch
+    physics.Get(top)->impulse = {0.0f, 1.0f};
+    system.Update(1.0f / 60.0f);
+    EXPECT_FALSE(physics.Get(top)->isSleeping);
+    EXPECT_TRUE(physics.Get(bottom)->isSleeping);
+
+    collisionSystem.Update(1.0f / 60.0f);
+    system.Update(1.0f / 60.0f);
+    EXPECT_FALSE(physics.Get(bottom)->isSleeping);
+}
+
+TEST_F(PhysicsSystemTest, AdaptiveSubstepsOnlySplitFastBodies) {
+    PhysicsComponent body;
+    body.linearDamping = 0.0f;
+    body.maxSpeed = 5000.0f;
+
+    body.velocity = {1000.0f, 0.0f};
+    EntityID fast = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} }, body);
+
+    body.velocity = {10.0f, 0.0f};
+    EntityID slow = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} }, body);
+
+    body.velocity = {0.0f, 0.0f};
+    body.impulse = {600.0f, -100.0f};  // fast only after the impulse
+    EntityID kicked = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} }, body);
+
+    PhysicsSystem system(transforms, accelerations, physics);
+    system.SetSubsteps(4);
+    system.SetAdaptiveSubsteps(true, 500.0f);
+    system.Update(1.0f);
+
+    // Gravity is applied once per frame either way, the impulse only once
+    EXPECT_FLOAT_EQ(physics.Get(fast)->velocity.y, 9.81f);
+    EXPECT_FLOAT_EQ(physics.Get(slow)->velocity.y, 9.81f);
+    EXPECT_FLOAT_EQ(physics.Get(kicked)->velocity.x, 600.0f);
+    EXPECT_FLOAT_EQ(physics.Get(kicked)->velocity.y, -100.0f + 9.81f);
+
+    // 4 substeps: y = g/4 * (1 + 2 + 3 + 4) / 4, a single step: y = g
+    EXPECT_NEAR(transforms.Get(fast)->position.y, 9.81f * 10.0f / 16.0f, 1e-4f);
+    EXPECT_FLOAT_EQ(transforms.Get(slow)->position.y, 9.81f);
+    EXPECT_FLOAT_EQ(transforms.Get(fast)->position.x, 1000.0f);
+    EXPECT_FLOAT_EQ(transforms.Get(kicked)->position.x, 600.0f);
+}
+
+TEST(IntegratorKernelTest, MatchesScalarPath) {
+    // Odd count so the scalar tail runs too
+    const size_t count = 37;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> value(-300.0f, 300.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    BodyLanes lanes;
+    lanes.Resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        lanes.vx[i] = value(rng);
+        lanes.vy[i] = value(rng);
+        lanes.ax[i] = value(rng);
+        lanes.ay[i] = value(rng);
+        lanes.fx[i] = value(rng);
+        lanes.fy[i] = value(rng);
+        lanes.ix[i] = i % 3 == 0 ? value(rng) : 0.0f;
+        lanes.iy[i] = i % 3 == 0 ? value(rng) : 0.0f;
+        lanes.mass[i] = 0.5f + unit(rng) * 4.0f;
+        lanes.invMass[i] = i % 5 == 0 ? 0.0f : 1.0f / lanes.mass[i];  // some static bodies
+        lanes.gravityScale[i] = unit(rng) * 2.0f;
+        lanes.friction[i] = unit(rng);
+        lanes.damping[i] = unit(rng) * 0.1f;
+        lanes.maxSpeed[i] = 100.0f + unit(rng) * 400.0f;
+        lanes.grounded[i] = i % 2 ? 1.0f : 0.0f;
+    }
+    lanes.vx[4] = lanes.vy[4] = 0.0f;  // grounded at rest -> static friction
+    lanes.vx[6] = 0.001f;
+    lanes.vy[6] = 0.0f;
+
+    BodyLanes scalar = lanes;
+    IntegrateBodies(lanes, 0, count, 1.0f / 60.0f, 981.0f);
+    IntegrateBodiesScalar(scalar, 0, count, 1.0f / 60.0f, 981.0f);
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_NEAR(lanes.vx[i], scalar.vx[i], 1e-5f * std::max(1.0f, std::abs(scalar.vx[i]))) << i;
+        EXPECT_NEAR(lanes.vy[i], scalar.vy[i], 1e-5f * std::max(1.0f, std::abs(scalar.vy[i]))) << i;
+        EXPECT_NEAR(lanes.speed[i], scalar.speed[i], 1e-5f * std::max(1.0f, scalar.speed[i])) << i;
+        EXPECT_LE(scalar.speed[i], scalar.maxSpeed[i]);
+    }
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <SDL2/SDL.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "graphics/RenderCommandList.h"
+#include "graphics/RenderFrames.h"
+
+// Logs every call it receives, in order
+class LogRenderer : public IRenderer {
+public:
+    std::vector<std::string> calls;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    SDL_Rect lastSrc{};
+    SDL_Rect lastDst{};
+    bool lastHadSrc = false;
+    SDL_Color lastColor{};
+
+    void DrawTexture(SDL_Texture*, const SDL_Rect* srcRect, const SDL_Rect* dstRect) override {
+        calls.push_back("texture");
+        lastHadSrc = srcRect != nullptr;
+        if (srcRect) lastSrc = *srcRect;
+        if (dstRect) lastDst = *dstRect;
+    }
+
+    void DrawGeometry(SDL_Texture*, const SDL_Vertex* v, int numVertices, const int* i, int numIndices) override {
+        calls.push_back("geometry");
+        vertices.assign(v, v + numVertices);
+        indices.assign(i, i + numIndices);
+    }
+
+    void DrawLine(int x1, int y1, int x2, int y2, SDL_Color color) override {
+        calls.push_back("line");
+        lastDst = { x1, y1, x2, y2 };
+        lastColor = color;
+    }
+};
+
+TEST(RenderCommandListTest, ReplaysCallsInOrder) {
+    RenderCommandList list;
+    SDL_Texture* texture = reinterpret_cast<SDL_Texture*>(0x1);
+
+    const SDL_Rect src = { 1, 2, 3, 4 };
+    const SDL_Rect dst = { 10, 20, 30, 40 };
+    list.DrawLine(0, 0, 100, 50, SDL_Color{80, 80, 80, 255});
+    list.DrawTexture(texture, &src, &dst);
+    list.DrawTexture(texture, nullptr, &dst);
+
+    LogRenderer renderer;
+    list.Execute(renderer);
+
+    EXPECT_EQ(renderer.calls, (std::vector<std::string>{ "line", "texture", "texture" }));
+    EXPECT_FALSE(renderer.lastHadSrc);
+    EXPECT_EQ(renderer.lastDst.w, 30);
+    EXPECT_EQ(list.GetCommandCount(), 3u);
+}
+
+TEST(RenderCommandListTest, GeometryIsCopiedAtRecordTime) {
+    RenderCommandList list;
+    std::vector<SDL_Vertex> scratch(4);
+    std::vector<int> indices = { 0, 1, 2, 0, 2, 3 };
+    for (int i = 0; i < 4; ++i) scratch[i].position = { static_cast<float>(i), 0.0f };
+
+    list.DrawGeometry(nullptr, scratch.data(), 4, indices.data(), 6);
+
+    // The recorder reuses its buffer straight away
+    for (auto& v : scratch) v.position = { -1.0f, -1.0f };
+    indices.assign(6, 0);
+
+    LogRenderer renderer;
+    list.Execute(renderer);
+
+    ASSERT_EQ(renderer.vertices.size(), 4u);
+    EXPECT_FLOAT_EQ(renderer.vertices[3].position.x, 3.0f);
+    EXPECT_EQ(renderer.indices, (std::vector<int>{ 0, 1, 2, 0, 2, 3 }));
+    EXPECT_EQ(list.GetVertexCount(), 4u);
+}
+
+TEST(RenderCommandListTest, ClearKeepsNothing) {
+    RenderCommandList list;
+    list.DrawLine(0, 0, 1, 1, SDL_Color{255, 255, 255, 255});
+    list.Clear();
+
+    LogRenderer renderer;
+    list.Execute(renderer);
+    EXPECT_TRUE(renderer.calls.empty());
+    EXPECT_EQ(list.GetCommandCount(), 0u);
+}
+
+// Every published frame reaches the render side exactly once, in order
+TEST(RenderFramesTest, HandsOffEveryFrameInOrder) {
+    RenderFrames frames;
+    const int frameCount = 100;
+
+    std::thread simulation([&] {
+        for (int f = 0; f < frameCount; ++f) {
+            RenderCommandList& list = frames.BeginRecord();
+            list.DrawLine(f, 0, 0, 0, SDL_Color{255, 255, 255, 255});
+            frames.Publish();
+        }
+    });
+
+    std::vector<int> seen;
+    while (static_cast<int>(seen.size()) < frameCount) {
+        const RenderCommandList* list = frames.Acquire();
+        ASSERT_NE(list, nullptr);
+        LogRenderer renderer;
+        list->Execute(renderer);
+        ASSERT_EQ(renderer.calls.size(), 1u);
+        seen.push_back(renderer.lastDst.x);
+        frames.Release();
+    }
+    simulation.join();
+
+    for (int f = 0; f < frameCount; ++f) EXPECT_EQ(seen[f], f);
+}
+
+TEST(RenderFramesTest, StopWakesBlockedSides) {
+    RenderFrames frames;
+
+    std::thread render([&] { EXPECT_EQ(frames.Acquire(), nullptr); });
+    frames.Stop();
+    render.join();
+
+    // Publish no longer waits once stopped
+    frames.BeginRecord();
+    frames.Publish();
+    frames.Publish();
+}
+
+// The render side never waits, and can present the last frame while the next one is recorded
+TEST(RenderFramesTest, TryAcquireKeepsTheLastFrame) {
+    RenderFrames frames;
+    EXPECT_EQ(frames.TryAcquire(), nullptr);
+    EXPECT_EQ(frames.GetLast().GetCommandCount(), 0u);
+
+    frames.BeginRecord().DrawLine(1, 0, 0, 0, SDL_Color{255, 255, 255, 255});
+    frames.Publish();
+
+    const RenderCommandList* list = frames.TryAcquire();
+    ASSERT_NE(list, nullptr);
+    frames.Release();
+    EXPECT_EQ(frames.TryAcquire(), nullptr);
+
+    // Recording the next frame doesn't touch the last one
+    frames.BeginRecord().DrawLine(2, 0, 0, 0, SDL_Color{255, 255, 255, 255});
+    frames.Publish();
+
+    LogRenderer renderer;
+    frames.GetLast().Execute(renderer);
+    EXPECT_EQ(renderer.lastDst.x, 1);
+
+    ASSERT_NE(frames.TryAcquire(), nullptr);
+    frames.Release();
+    frames.GetLast().Execute(renderer);
+    EXPECT_EQ(renderer.lastDst.x, 2);
+
+    frames.Stop();
+    EXPECT_EQ(frames.TryAcquire(), nullptr);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <SDL2/SDL.h>
+#include "graphics/RenderQueue.h"
+#include "utils/RadixSort.h"
+
+#include <algorithm>
+#include <random>
+
+// Records the top-left x of every quad in draw order, plus the texture of each batch
+class OrderRenderer : public IRenderer {
+public:
+    std::vector<float> xs;
+    std::vector<SDL_Texture*> batches;
+
+    void DrawTexture(SDL_Texture*, const SDL_Rect*, const SDL_Rect*) override {}
+
+    void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                      const int*, int) override {
+        batches.push_back(texture);
+        for (int v = 0; v < numVertices; v += 4) xs.push_back(vertices[v].position.x);
+    }
+
+    void DrawLine(int, int, int, int, SDL_Color) override {}
+};
+
+class RenderQueueTest : public ::testing::Test {
+protected:
+    RenderQueue queue;
+    OrderRenderer renderer;
+
+    SDL_Texture* a = reinterpret_cast<SDL_Texture*>(0x1);
+    SDL_Texture* b = reinterpret_cast<SDL_Texture*>(0x2);
+
+    // x doubles as a label for the quad
+    void Push(SDL_Texture* texture, int layer, float label, float sortY = 0.0f) {
+        queue.Push(texture, layer, SDL_FRect{label, 0.0f, 8.0f, 8.0f}, SDL_FRect{0.0f, 0.0f, 1.0f, 1.0f}, sortY);
+    }
+};
+
+TEST(RadixSortTest, MatchesStableSort) {
+    std::mt19937_64 rng(3);
+    std::vector<SortItem> items;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        // Few distinct keys so stability matters, spread over high and low bytes
+        const uint64_t key = (rng() % 7) << 56 | (rng() % 5) << 20 | (rng() % 3);
+        items.push_back({ key, i });
+    }
+
+    std::vector<SortItem> expected = items;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const SortItem& x, const SortItem& y) { return x.key < y.key; });
+
+    std::vector<SortItem> scratch;
+    RadixSortStable(items, scratch);
+
+    ASSERT_EQ(items.size(), expected.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        EXPECT_EQ(items[i].key, expected[i].key);
+        EXPECT_EQ(items[i].index, expected[i].index);
+    }
+}
+
+TEST_F(RenderQueueTest, LayersFirstIncludingNegative) {
+    Push(a, 2, 1.0f);
+    Push(a, -3, 2.0f);
+    Push(a, 0, 3.0f);
+    queue.Flush(&renderer);
+
+    EXPECT_EQ(renderer.xs, (std::vector<float>{2.0f, 3.0f, 1.0f}));
+    EXPECT_EQ(renderer.batches.size(), 3u);
+}
+
+TEST_F(RenderQueueTest, YSortOrdersWithinALayerAndKeepsTiesInSubmissionOrder) {
+    Push(a, 0, 1.0f, 300.0f);
+    Push(b, 0, 2.0f, 100.0f);
+    Push(a, 0, 3.0f, 200.0f);
+    Push(b, 0, 4.0f, 200.0f);
+    queue.Flush(&renderer);
+
+    EXPECT_EQ(renderer.xs, (std::vector<float>{2.0f, 3.0f, 4.0f, 1.0f}));
+}
+
+TEST_F(RenderQueueTest, SkipsTheSortWhenKeysRepeat) {
+    for (int frame = 0; frame < 3; ++frame) {
+        renderer.xs.clear();
+        Push(b, 0, 1.0f);
+        Push(a, 0, 2.0f);
+        Push(b, 0, 3.0f);
+        queue.Flush(&renderer);
+
+        EXPECT_EQ(queue.GetStats().sortSkipped, frame > 0);
+        EXPECT_EQ(renderer.xs, (std::vector<float>{1.0f, 3.0f, 2.0f}));  // b seen first
+        EXPECT_EQ(queue.GetStats().batches, 2u);
+    }
+
+    // A changed key sorts again
+    renderer.xs.clear();
+    Push(b, 0, 1.0f);
+    Push(a, -1, 2.0f);
+    Push(b, 0, 3.0f);
+    queue.Flush(&renderer);
+
+    EXPECT_FALSE(queue.GetStats().sortSkipped);
+    EXPECT_EQ(renderer.xs, (std::vector<float>{2.0f, 1.0f, 3.0f}));
+}
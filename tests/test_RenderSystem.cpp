@@ -19,12 +19,16 @@ private:
     SDL_Texture* m_texture;
 };
 
-// Mock Renderer that counts draw calls and captures draw parameters
+// Mock Renderer that counts draw calls and batches and captures the last sprite quad
 class TestRenderer : public IRenderer {
 public:
-    int drawCalls = 0;
+    int drawCalls = 0;   // DrawTexture (background layers)
+    int batches = 0;     // DrawGeometry
+    int quads = 0;       // sprites drawn through batches
+    std::vector<SDL_Texture*> batchTextures;
     SDL_Texture* lastTexture = nullptr;
     SDL_Rect lastDstRect = {};
+    SDL_FPoint lastUVMin = {}, lastUVMax = {};
 
     void DrawTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect* dstRect) override {
         drawCalls++;
@@ -33,6 +37,24 @@ public:
             lastDstRect = *dstRect;
         }
     }
+
+    void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                      const int* indices, int numIndices) override {
+        batches++;
+        quads += numVertices / 4;
+        batchTextures.push_back(texture);
+        lastTexture = texture;
+
+        // Quad corners: top-left, top-right, bottom-right, bottom-left
+        const SDL_Vertex* q = vertices + numVertices - 4;
+        lastDstRect = { static_cast<int>(q[0].position.x), static_cast<int>(q[0].position.y),
+                        static_cast<int>(q[2].position.x - q[0].position.x),
+                        static_cast<int>(q[2].position.y - q[0].position.y) };
+        lastUVMin = q[0].tex_coord;
+        lastUVMax = q[2].tex_coord;
+    }
+
+    void DrawLine(int x1, int y1, int x2, int y2, SDL_Color color) override {}
 };
 
 class RenderSystemTest : public ::testing::Test {
@@ -67,7 +89,7 @@ TEST_F(RenderSystemTest, RendersEntityWithValidComponents) {
     // Camera defaults to (0,0), zoom = 1
     system.Update(1.0f);
 
-    EXPECT_EQ(renderer.drawCalls, 1);
+    EXPECT_EQ(renderer.quads, 1);
 
     // EXPECTED: pivot center top-left = position - halfSize
     EXPECT_EQ(renderer.lastDstRect.x, 100 - 32);
@@ -85,7 +107,7 @@ TEST_F(RenderSystemTest, SkipsEntityWithoutTransform) {
     RenderSystem system(transforms, sprites, &renderer);
     system.Update(0.016f);
 
-    EXPECT_EQ(renderer.drawCalls, 0);
+    EXPECT_EQ(renderer.quads, 0);
 }
 
 TEST_F(RenderSystemTest, SkipsEntityWithoutTexture) {
@@ -97,7 +119,7 @@ TEST_F(RenderSystemTest, SkipsEntityWithoutTexture) {
     RenderSystem system(transforms, sprites, &renderer);
     system.Update(0.016f);
 
-    EXPECT_EQ(renderer.drawCalls, 0);
+    EXPECT_EQ(renderer.quads, 0);
 }
 
 TEST_F(RenderSystemTest, AppliesCameraOffset) {
@@ -111,7 +133,7 @@ TEST_F(RenderSystemTest, AppliesCameraOffset) {
 
     system.Update(1.0f);
 
-    EXPECT_EQ(renderer.drawCalls, 1);
+    EXPECT_EQ(renderer.quads, 1);
 
     // expected = (pos - halfSize - camera)
     EXPECT_EQ(renderer.lastDstRect.x, (200 - 32 - 100));
@@ -129,10 +151,178 @@ TEST_F(RenderSystemTest, AppliesCameraZoom) {
 
     system.Update(1.0f);
 
-    EXPECT_EQ(renderer.drawCalls, 1);
+    EXPECT_EQ(renderer.quads, 1);
 
     EXPECT_EQ(renderer.lastDstRect.x, (100 - 32) * 2);
     EXPECT_EQ(renderer.lastDstRect.y, (100 - 32) * 2);
     EXPECT_EQ(renderer.lastDstRect.w, 64 * 2);
     EXPECT_EQ(renderer.lastDstRect.h, 64 * 2);
 }
+
+TEST_F(RenderSystemTest, CullsSpritesOutsideViewport) {
+    EntityID inside = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{400.0f, 300.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        SpriteComponent{&texture, 64, 64}
+    );
+    EntityID edge = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{810.0f, 300.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},  // half on screen
+        SpriteComponent{&texture, 64, 64}
+    );
+    EntityID far = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{5000.0f, 300.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        SpriteComponent{&texture, 64, 64}
+    );
+
+    RenderSystem system(transforms, sprites, &renderer);
+    system.SetViewportSize({800, 600});
+    system.Update(0.016f);
+
+    EXPECT_EQ(renderer.quads, 2);
+    EXPECT_TRUE(system.IsVisible(inside));
+    EXPECT_TRUE(system.IsVisible(edge));
+    EXPECT_FALSE(system.IsVisible(far));
+    EXPECT_EQ(system.GetVisibleEntities(), (std::vector<EntityID>{inside, edge}));
+}
+
+TEST_F(RenderSystemTest, ZoomShrinksTheVisibleWorld) {
+    EntityID near = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{100.0f, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        SpriteComponent{&texture, 32, 32}
+    );
+    EntityID right = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{600.0f, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        SpriteComponent{&texture, 32, 32}
+    );
+
+    RenderSystem system(transforms, sprites, &renderer);
+    system.SetViewportSize({800, 600});
+    system.SetCameraZoom(2.0f);  // 400 x 300 world units
+    system.Update(0.016f);
+
+    EXPECT_TRUE(system.IsVisible(near));
+    EXPECT_FALSE(system.IsVisible(right));
+}
+
+TEST_F(RenderSystemTest, OnlyMovedSpritesAreReinserted) {
+    EntityID mover = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{2000.0f, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        SpriteComponent{&texture, 32, 32}
+    );
+    for (int i = 0; i < 10; ++i) {
+        creationSystem.CreateEntityWith(
+            TransformComponent{VectorFloat{50.0f * i, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+            SpriteComponent{&texture, 32, 32}
+        );
+    }
+
+    RenderSystem system(transforms, sprites, &renderer);
+    system.SetViewportSize({800, 600});
+    system.Update(0.016f);
+    EXPECT_FALSE(system.IsVisible(mover));
+    EXPECT_EQ(system.GetStats().sprites, 11u);
+
+    system.Update(0.016f);
+    EXPECT_EQ(system.GetStats().moved, 0u);
+
+    transforms.Get(mover)->position = {700.0f, 300.0f};
+    system.Update(0.016f);
+    EXPECT_EQ(system.GetStats().moved, 1u);
+    EXPECT_TRUE(system.IsVisible(mover));
+    EXPECT_EQ(system.GetStats().visible, 11u);
+}
+
+TEST_F(RenderSystemTest, RemovedSpritesLeaveTheIndex) {
+    EntityID entity = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{100.0f, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        SpriteComponent{&texture, 32, 32}
+    );
+
+    RenderSystem system(transforms, sprites, &renderer);
+    system.SetViewportSize({800, 600});
+    system.Update(0.016f);
+    EXPECT_TRUE(system.IsVisible(entity));
+
+    entityManager.DestroyEntityFromList(entity);
+    renderer.quads = 0;
+    system.Update(0.016f);
+
+    EXPECT_EQ(renderer.quads, 0);
+    EXPECT_FALSE(system.IsVisible(entity));
+}
+
+TEST_F(RenderSystemTest, BatchesSpritesByLayerThenTexture) {
+    SDL_Texture* otherSDLTexture = reinterpret_cast<SDL_Texture*>(0x2);
+    MockTexture other{otherSDLTexture};
+
+    // Interleaved textures on layer 0, one sprite on layer 1
+    for (int i = 0; i < 6; ++i) {
+        creationSystem.CreateEntityWith(
+            TransformComponent{VectorFloat{50.0f * i, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+            SpriteComponent{i % 2 ? &other : &texture, 32, 32}
+        );
+    }
+    creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{10.0f, 10.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        SpriteComponent{&texture, 32, 32, 1}
+    );
+
+    RenderSystem system(transforms, sprites, &renderer);
+    system.Update(0.016f);
+
+    EXPECT_EQ(renderer.quads, 7);
+    ASSERT_EQ(renderer.batches, 3);
+    EXPECT_EQ(renderer.batchTextures.back(), dummySDLTexture);  // layer 1 last
+    EXPECT_EQ(system.GetQueueStats().batches, 3u);
+    EXPECT_EQ(system.GetQueueStats().quads, 7u);
+}
+
+TEST_F(RenderSystemTest, AtlasSpritesSampleTheirRegion) {
+    MockTexture page{dummySDLTexture};
+    page.SetSize(256, 128);
+
+    SpriteComponent sprite;
+    sprite.SetTexture(&page, SDL_Rect{64, 32, 32, 16});
+    EXPECT_EQ(sprite.width, 32);
+    EXPECT_EQ(sprite.height, 16);
+
+    creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{100.0f, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}},
+        sprite
+    );
+
+    RenderSystem system(transforms, sprites, &renderer);
+    system.Update(0.016f);
+
+    ASSERT_EQ(renderer.quads, 1);
+    EXPECT_FLOAT_EQ(renderer.lastUVMin.x, 0.25f);
+    EXPECT_FLOAT_EQ(renderer.lastUVMin.y, 0.25f);
+    EXPECT_FLOAT_EQ(renderer.lastUVMax.x, 0.375f);
+    EXPECT_FLOAT_EQ(renderer.lastUVMax.y, 0.375f);
+    EXPECT_EQ(renderer.lastDstRect.w, 32);
+}
+
+TEST_F(RenderSystemTest, YSortedSpritesDrawLowerOnesLast) {
+    SpriteComponent sprite{&texture, 32, 32};
+    sprite.ySort = true;
+
+    // Created top to bottom reversed: ids no longer match the wanted order
+    EntityID front = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{100.0f, 300.0f}, 0.0f, VectorFloat{1.0f, 1.0f}}, sprite);
+    EntityID back = creationSystem.CreateEntityWith(
+        TransformComponent{VectorFloat{200.0f, 100.0f}, 0.0f, VectorFloat{1.0f, 1.0f}}, sprite);
+
+    RenderSystem system(transforms, sprites, &renderer);
+    system.Update(0.016f);
+
+    ASSERT_EQ(renderer.quads, 2);
+    EXPECT_EQ(renderer.lastDstRect.x, 100 - 16);  // front drawn last
+
+    // Nothing moved: same keys, the sort is skipped
+    system.Update(0.016f);
+    EXPECT_TRUE(system.GetQueueStats().sortSkipped);
+
+    transforms.Get(back)->position.y = 400.0f;
+    system.Update(0.016f);
+    EXPECT_FALSE(system.GetQueueStats().sortSkipped);
+    EXPECT_EQ(renderer.lastDstRect.x, 200 - 16);
+}
@@ -0,0 +1,161 @@
+#include "components/TransformComponent.h"
+#include "components/ColliderComponent.h"
+#include "core/EntityManager.h"
+#include "core/ComponentStorage.h"
+#include "systems/CollisionSystem.h"
+#include "systems/SpatialQuery.h"
+#include "systems/EntityCreationSystem.h"
+#include "AI/AIController.h"
+
+#include <gtest/gtest.h>
+
+class SpatialQueryTest : public ::testing::Test {
+protected:
+    EntityManager entityManager;
+    ComponentStorage<TransformComponent> transforms;
+    ComponentStorage<ColliderComponent> colliders;
+    EntityCreationSystem creationSystem{&entityManager};
+
+    CollisionSystem collisionSystem{entityManager, transforms, colliders};
+    SpatialQuery query{collisionSystem};
+
+    void SetUp() override {
+        creationSystem.RegisterStorage(&transforms);
+        creationSystem.RegisterStorage(&colliders);
+    }
+
+    EntityID CreateBox(float x, float y, int w, int h, CollisionLayer layer) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            ColliderComponent{w, h, layer, CollisionLayer::All}
+        );
+    }
+};
+
+TEST_F(SpatialQueryTest, RaycastReturnsClosestHitAcrossCells) {
+    EntityID nearWall = CreateBox(200.0f, -50.0f, 10, 100, CollisionLayer::Wall);
+    EntityID farWall  = CreateBox(400.0f, -50.0f, 10, 100, CollisionLayer::Wall);
+    collisionSystem.Update(0.0f);
+
+    RaycastHit hit;
+    ASSERT_TRUE(query.Raycast(VectorFloat{0.0f, 0.0f}, VectorFloat{1.0f, 0.0f}, 1000.0f, hit));
+    EXPECT_EQ(hit.entity, nearWall);
+    EXPECT_FLOAT_EQ(hit.distance, 200.0f);
+    EXPECT_FLOAT_EQ(hit.normal.x, -1.0f);
+
+    auto all = query.RaycastAll(VectorFloat{0.0f, 0.0f}, VectorFloat{1.0f, 0.0f}, 1000.0f);
+    ASSERT_EQ(all.size(), 2);
+    EXPECT_EQ(all[0].entity, nearWall);
+    EXPECT_EQ(all[1].entity, farWall);
+
+    // Too short
+    EXPECT_FALSE(query.Raycast(VectorFloat{0.0f, 0.0f}, VectorFloat{1.0f, 0.0f}, 150.0f, hit));
+}
+
+TEST_F(SpatialQueryTest, RaycastFiltersByLayer) {
+    CreateBox(100.0f, -10.0f, 20, 20, CollisionLayer::Pickup);
+    EntityID wall = CreateBox(300.0f, -10.0f, 20, 20, CollisionLayer::Wall);
+    collisionSystem.Update(0.0f);
+
+    RaycastHit hit;
+    ASSERT_TRUE(query.Raycast(VectorFloat{0.0f, 0.0f}, VectorFloat{1.0f, 0.0f}, 1000.0f, hit,
+                              CollisionLayer::Wall));
+    EXPECT_EQ(hit.entity, wall);
+}
+
+TEST_F(SpatialQueryTest, OverlapAndNearestQueries) {
+    EntityID a = CreateBox(0.0f, 0.0f, 10, 10, CollisionLayer::Enemy);
+    EntityID b = CreateBox(50.0f, 0.0f, 10, 10, CollisionLayer::Enemy);
+    EntityID c = CreateBox(300.0f, 300.0f, 10, 10, CollisionLayer::Enemy);
+    collisionSystem.Update(0.0f);
+
+    auto boxHits = query.OverlapBox(AABB{ -5.0f, -5.0f, 60.0f, 10.0f });
+    EXPECT_EQ(boxHits, (std::vector<EntityID>{ a, b }));
+
+    auto circleHits = query.OverlapCircle(VectorFloat{305.0f, 305.0f}, 20.0f);
+    EXPECT_EQ(circleHits, (std::vector<EntityID>{ c }));
+
+    auto nearest = query.NearestK(VectorFloat{40.0f, 5.0f}, 2, 1000.0f);
+    EXPECT_EQ(nearest, (std::vector<EntityID>{ b, a }));
+}
+
+TEST_F(SpatialQueryTest, OverlapPointReturnsContainingBoxes) {
+    EntityID big   = CreateBox(0.0f, 0.0f, 200, 200, CollisionLayer::Wall);
+    EntityID small = CreateBox(90.0f, 90.0f, 20, 20, CollisionLayer::Enemy);
+    collisionSystem.Update(0.0f);
+
+    EXPECT_EQ(query.OverlapPoint(VectorFloat{100.0f, 100.0f}), (std::vector<EntityID>{ big, small }));
+    EXPECT_EQ(query.OverlapPoint(VectorFloat{150.0f, 150.0f}), (std::vector<EntityID>{ big }));
+    EXPECT_TRUE(query.OverlapPoint(VectorFloat{250.0f, 10.0f}).empty());
+
+    // Layer mask rejects the wall
+    EXPECT_EQ(query.OverlapPoint(VectorFloat{100.0f, 100.0f}, CollisionLayer::Enemy),
+              (std::vector<EntityID>{ small }));
+}
+
+TEST_F(SpatialQueryTest, OverlapBoxRejectsOtherLayers) {
+    CreateBox(0.0f, 0.0f, 10, 10, CollisionLayer::Pickup);
+    EntityID enemy = CreateBox(20.0f, 0.0f, 10, 10, CollisionLayer::Enemy);
+    collisionSystem.Update(0.0f);
+
+    const AABB area{ -5.0f, -5.0f, 50.0f, 20.0f };
+    EXPECT_EQ(query.OverlapBox(area, CollisionLayer::Enemy), (std::vector<EntityID>{ enemy }));
+    EXPECT_TRUE(query.OverlapBox(area, CollisionLayer::Wall).empty());
+    EXPECT_TRUE(query.OverlapCircle(VectorFloat{5.0f, 5.0f}, 30.0f, CollisionLayer::Wall).empty());
+}
+
+TEST_F(SpatialQueryTest, RayThatMissesReportsNothing) {
+    CreateBox(200.0f, 50.0f, 10, 10, CollisionLayer::Wall);
+    EntityID self = CreateBox(-5.0f, -5.0f, 10, 10, CollisionLayer::Enemy);
+    collisionSystem.Update(0.0f);
+
+    RaycastHit hit;
+    EXPECT_FALSE(query.Raycast(VectorFloat{0.0f, 0.0f}, VectorFloat{1.0f, 0.0f}, 1000.0f, hit,
+                               CollisionLayer::All, self));
+    EXPECT_EQ(hit.entity, INVALID_ENTITY);
+    EXPECT_TRUE(query.RaycastAll(VectorFloat{0.0f, 0.0f}, VectorFloat{0.0f, -1.0f}, 1000.0f,
+                                 CollisionLayer::All, self).empty());
+}
+
+TEST_F(SpatialQueryTest, SweepBoxStopsAtFirstBoxOfTheMask) {
+    CreateBox(50.0f, 0.0f, 10, 10, CollisionLayer::Pickup);
+    EntityID wall = CreateBox(100.0f, 0.0f, 10, 10, CollisionLayer::Wall);
+    CreateBox(0.0f, 0.0f, 10, 10, CollisionLayer::Wall);  // already overlapped, ignored
+    collisionSystem.Update(0.0f);
+
+    const AABB box{ 0.0f, 0.0f, 10.0f, 10.0f };
+    SweepHit hit;
+    ASSERT_TRUE(query.SweepBox(box, VectorFloat{200.0f, 0.0f}, hit, CollisionLayer::Wall));
+    EXPECT_EQ(hit.entity, wall);
+    EXPECT_FLOAT_EQ(hit.toi, 90.0f / 200.0f);
+    EXPECT_FLOAT_EQ(hit.normal.x, -1.0f);
+
+    // Moving away hits nothing
+    EXPECT_FALSE(query.SweepBox(box, VectorFloat{-200.0f, 0.0f}, hit, CollisionLayer::Wall));
+}
+
+TEST_F(SpatialQueryTest, NearestKHonoursRangeMaskAndIgnore) {
+    EntityID self  = CreateBox(0.0f, 0.0f, 10, 10, CollisionLayer::Enemy);
+    EntityID close = CreateBox(30.0f, 0.0f, 10, 10, CollisionLayer::Enemy);
+    CreateBox(15.0f, 0.0f, 5, 5, CollisionLayer::Pickup);
+    CreateBox(600.0f, 0.0f, 10, 10, CollisionLayer::Enemy);  // out of range
+    collisionSystem.Update(0.0f);
+
+    const auto nearest = query.NearestK(VectorFloat{5.0f, 5.0f}, 5, 200.0f, CollisionLayer::Enemy, self);
+    EXPECT_EQ(nearest, (std::vector<EntityID>{ close }));
+}
+
+TEST_F(SpatialQueryTest, WallsBlockAILineOfSight) {
+    CreateBox(100.0f, -50.0f, 10, 100, CollisionLayer::Wall);
+    CreateBox(100.0f, 200.0f, 10, 10, CollisionLayer::Enemy);  // not a wall, doesn't block
+    collisionSystem.Update(0.0f);
+
+    AIController agent(100, 100);
+    agent.SetPosition(VectorFloat{0.0f, 0.0f});
+    EXPECT_TRUE(agent.HasLineOfSight(VectorFloat{300.0f, 0.0f}));  // no query set: unobstructed
+
+    agent.SetSpatialQuery(&query);
+    EXPECT_FALSE(agent.HasLineOfSight(VectorFloat{300.0f, 0.0f}));
+    EXPECT_TRUE(agent.HasLineOfSight(VectorFloat{50.0f, 0.0f}));
+    EXPECT_TRUE(agent.HasLineOfSight(VectorFloat{300.0f, 205.0f}));
+}
@@ -0,0 +1,125 @@
+#include "systems/TileCollisionMap.h"
+#include "systems/PhysicsSystem.h"
+#include "systems/EntityCreationSystem.h"
+#include "core/EntityManager.h"
+#include "core/ComponentStorage.h"
+#include "components/TransformComponent.h"
+#include "components/PhysicsComponent.h"
+#include "components/AccelerationComponent.h"
+#include "components/ColliderComponent.h"
+
+#include <gtest/gtest.h>
+
+class TileCollisionMapTest : public ::testing::Test {
+protected:
+    TileCollisionMap map;
+
+    void SetUp() override {
+        // 32px tiles, origin at (0, 0)
+        ASSERT_TRUE(map.LoadFromJson(nlohmann::json::parse(R"({
+            "tileSize": 32,
+            "rows": [
+                "..........",
+                "....==....",
+                "..........",
+                "../##.....",
+                "######..#.",
+                "##########"
+            ]
+        })")));
+    }
+};
+
+TEST_F(TileCollisionMapTest, LoadsCompactGrid) {
+    EXPECT_EQ(map.GetWidth(), 10);
+    EXPECT_EQ(map.GetHeight(), 6);
+    EXPECT_EQ(map.GetTile(4, 1), TileShape::OneWay);
+    EXPECT_EQ(map.GetTile(2, 3), TileShape::SlopeUp);
+    EXPECT_EQ(map.GetTile(0, 5), TileShape::Solid);
+    EXPECT_EQ(map.GetTile(-1, 0), TileShape::Empty);
+}
+
+TEST_F(TileCollisionMapTest, LandsOnFloorWithoutTunneling) {
+    // Falling 500px in one frame onto the floor at y = 160 (row 5), columns 6-7
+    TileContact contact;
+    const VectorFloat moved = map.Move(AABB{ 196.0f, 0.0f, 20.0f, 20.0f }, { 0.0f, 500.0f }, contact);
+
+    EXPECT_FLOAT_EQ(moved.y, 140.0f);
+    EXPECT_TRUE(contact.ground);
+}
+
+TEST_F(TileCollisionMapTest, WallsBlockHorizontally) {
+    // Standing on row 5 between the wall at column 8
+    TileContact contact;
+    const VectorFloat moved = map.Move(AABB{ 200.0f, 140.0f, 20.0f, 20.0f }, { 100.0f, 0.0f }, contact);
+
+    EXPECT_FLOAT_EQ(moved.x, 36.0f);
+    EXPECT_TRUE(contact.right);
+    EXPECT_TRUE(contact.ground);
+}
+
+TEST_F(TileCollisionMapTest, OneWayOnlyFromAbove) {
+    TileContact contact;
+
+    // Jumping up through it
+    VectorFloat moved = map.Move(AABB{ 130.0f, 70.0f, 20.0f, 20.0f }, { 0.0f, -60.0f }, contact);
+    EXPECT_FLOAT_EQ(moved.y, -60.0f);
+    EXPECT_FALSE(contact.ceiling);
+
+    // Falling onto it
+    moved = map.Move(AABB{ 130.0f, 0.0f, 20.0f, 20.0f }, { 0.0f, 40.0f }, contact);
+    EXPECT_FLOAT_EQ(moved.y, 12.0f);
+    EXPECT_TRUE(contact.ground);
+}
+
+TEST_F(TileCollisionMapTest, SlopeLiftsWalkingBox) {
+    // Feet at the bottom of the '/' tile (column 2, row 3), walking right
+    TileContact contact;
+    const VectorFloat moved = map.Move(AABB{ 54.0f, 108.0f, 20.0f, 20.0f }, { 10.0f, 1.0f }, contact);
+
+    // Middle of the box ends at x = 74 -> 10px into the tile -> floor at 128 - 10
+    EXPECT_FLOAT_EQ(moved.x, 10.0f);
+    EXPECT_FLOAT_EQ(108.0f + moved.y + 20.0f, 118.0f);
+    EXPECT_TRUE(contact.ground);
+}
+
+TEST_F(TileCollisionMapTest, SlopeTopStepsOntoSolidTile) {
+    // Feet on the upper part of the '/' tile, the middle crosses into the '#' next to it (top at 96)
+    TileContact contact;
+    const VectorFloat moved = map.Move(AABB{ 76.0f, 86.0f, 20.0f, 20.0f }, { 10.0f, 1.0f }, contact);
+
+    EXPECT_FLOAT_EQ(moved.x, 10.0f);
+    EXPECT_FLOAT_EQ(86.0f + moved.y + 20.0f, 96.0f);
+    EXPECT_TRUE(contact.ground);
+}
+
+TEST_F(TileCollisionMapTest, PhysicsStopsOnTilesAndIsGrounded) {
+    EntityManager entityManager;
+    EntityCreationSystem creationSystem{&entityManager};
+    ComponentStorage<TransformComponent> transforms;
+    ComponentStorage<PhysicsComponent> physics;
+    ComponentStorage<AccelerationComponent> accelerations;
+    ComponentStorage<ColliderComponent> colliders;
+    creationSystem.RegisterStorage(&transforms);
+    creationSystem.RegisterStorage(&physics);
+    creationSystem.RegisterStorage(&colliders);
+
+    PhysicsComponent body;
+    body.velocity = {0.0f, 2000.0f};
+    body.maxSpeed = 5000.0f;
+    body.linearDamping = 0.0f;
+
+    EntityID id = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{196.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+        body,
+        ColliderComponent{20, 20, CollisionLayer::Player, CollisionLayer::All}
+    );
+
+    PhysicsSystem system(transforms, accelerations, physics);
+    system.SetTileMap(&map, &colliders);
+    system.Update(0.5f);
+
+    EXPECT_FLOAT_EQ(transforms.Get(id)->position.y, 140.0f);
+    EXPECT_FLOAT_EQ(physics.Get(id)->velocity.y, 0.0f);
+    EXPECT_TRUE(physics.Get(id)->isGrounded);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <SDL2/SDL.h>
+#include <memory>
+#include <vector>
+
+#include "graphics/TilemapRenderer.h"
+#include "graphics/Texture.h"
+
+// Collects the chunk blits
+class BlitRenderer : public IRenderer {
+public:
+    std::vector<SDL_Rect> blits;
+
+    void DrawTexture(SDL_Texture*, const SDL_Rect*, const SDL_Rect* dstRect) override {
+        blits.push_back(dstRect ? *dstRect : SDL_Rect{});
+    }
+    void DrawGeometry(SDL_Texture*, const SDL_Vertex*, int, const int*, int) override {}
+    void DrawLine(int, int, int, int, SDL_Color) override {}
+};
+
+// Bakes with SDL's software renderer, no window needed
+class TilemapRendererTest : public ::testing::Test {
+protected:
+    SDL_Surface* surface = nullptr;
+    SDL_Renderer* sdl = nullptr;
+    std::unique_ptr<Texture> tileset;
+    std::unique_ptr<TilemapRenderer> tilemap;
+    BlitRenderer renderer;
+
+    void SetUp() override {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, 64, 64, 32, SDL_PIXELFORMAT_RGBA8888);
+        sdl = SDL_CreateSoftwareRenderer(surface);
+        ASSERT_NE(sdl, nullptr);
+
+        tileset = std::make_unique<Texture>();
+        tileset->SetSDLTexture(SDL_CreateTexture(sdl, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, 64, 64));
+        tileset->SetSize(64, 64);
+        tilemap = std::make_unique<TilemapRenderer>(512);
+    }
+
+    // Chunk textures and the tileset go before the renderer that owns them
+    void TearDown() override {
+        tilemap.reset();
+        tileset.reset();
+        if (sdl) SDL_DestroyRenderer(sdl);
+        if (surface) SDL_FreeSurface(surface);
+    }
+
+    // 32 px tiles, 16 per chunk side; tileset has 4 cells of 32 px
+    void Fill(int width, int height) {
+        tilemap->Resize(width, height, 32);
+        tilemap->SetTileset({ tileset.get(), {0, 0, 0, 0} }, 32);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) tilemap->SetTile(x, y, (x + y) % 4);
+        }
+    }
+};
+
+TEST_F(TilemapRendererTest, OnlyChangedChunksAreRebaked) {
+    Fill(64, 64);  // 4 x 4 chunks
+    EXPECT_EQ(tilemap->GetChunkTiles(), 16);
+    EXPECT_EQ(tilemap->GetStats().chunks, 16u);
+
+    tilemap->Bake(sdl);
+    EXPECT_EQ(tilemap->GetStats().baked, 16u);
+    EXPECT_EQ(tilemap->GetStats().dirty, 0u);
+
+    // Same value - nothing to do
+    tilemap->SetTile(5, 5, tilemap->GetTile(5, 5));
+    EXPECT_EQ(tilemap->GetStats().dirty, 0u);
+
+    tilemap->SetTile(17, 40, -1);
+    tilemap->SetTile(18, 41, 3);
+    EXPECT_EQ(tilemap->GetStats().dirty, 1u);
+
+    tilemap->Bake(sdl);
+    EXPECT_EQ(tilemap->GetStats().baked, 1u);
+    EXPECT_EQ(tilemap->GetTile(17, 40), -1);
+}
+
+TEST_F(TilemapRendererTest, DrawsOnlyChunksUnderTheCamera) {
+    Fill(64, 64);  // 2048 x 2048 px, 4096 tiles
+    tilemap->Bake(sdl);
+
+    tilemap->Draw(&renderer, {0, 0}, {800, 600}, 1.0f);
+    EXPECT_EQ(renderer.blits.size(), 4u);
+    EXPECT_EQ(tilemap->GetStats().drawn, 4u);
+
+    renderer.blits.clear();
+    tilemap->Draw(&renderer, {600, 0}, {800, 600}, 1.0f);
+    ASSERT_EQ(renderer.blits.size(), 4u);
+    EXPECT_EQ(renderer.blits[0].x, 512 - 600);
+    EXPECT_EQ(renderer.blits[0].w, 512);
+}
+
+TEST_F(TilemapRendererTest, EdgeChunksAndZoom) {
+    Fill(20, 1);  // 640 px: a full chunk and a 128 px one
+    tilemap->Bake(sdl);
+
+    tilemap->Draw(&renderer, {0, 0}, {0, 0}, 2.0f);
+    ASSERT_EQ(renderer.blits.size(), 2u);
+    EXPECT_EQ(renderer.blits[0].w, 1024);
+    EXPECT_EQ(renderer.blits[1].x, 1024);
+    EXPECT_EQ(renderer.blits[1].w, 256);
+    EXPECT_EQ(renderer.blits[1].h, 64);
+}
+
+TEST_F(TilemapRendererTest, EmptyChunksAreSkipped) {
+    tilemap->Resize(64, 64, 32);
+    tilemap->SetTileset({ tileset.get(), {0, 0, 0, 0} }, 32);
+    tilemap->SetTile(40, 40, 0);
+    tilemap->Bake(sdl);
+    EXPECT_EQ(tilemap->GetStats().baked, 1u);
+
+    tilemap->Draw(&renderer, {0, 0}, {0, 0}, 1.0f);
+    ASSERT_EQ(renderer.blits.size(), 1u);
+    EXPECT_EQ(renderer.blits[0].x, 1024);
+
+    // Cleared chunk keeps its texture but is no longer drawn
+    tilemap->SetTile(40, 40, -1);
+    tilemap->Bake(sdl);
+    renderer.blits.clear();
+    tilemap->Draw(&renderer, {0, 0}, {0, 0}, 1.0f);
+    EXPECT_TRUE(renderer.blits.empty());
+}
+
+// The render thread bakes every frame; only a targets reset re-renders anything
+TEST_F(TilemapRendererTest, PerFrameBakeIsANoOpUntilReset) {
+    Fill(64, 64);
+    tilemap->Bake(sdl);
+
+    tilemap->Bake(sdl);
+    EXPECT_EQ(tilemap->GetStats().baked, 0u);
+
+    tilemap->MarkAllDirty();
+    tilemap->Bake(sdl);
+    EXPECT_EQ(tilemap->GetStats().baked, 16u);
+    EXPECT_EQ(tilemap->GetStats().dirty, 0u);
+}
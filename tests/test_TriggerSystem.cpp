@@ -0,0 +1,127 @@
+#include "components/TransformComponent.h"
+#include "components/ColliderComponent.h"
+#include "core/EntityManager.h"
+#include "core/ComponentStorage.h"
+#include "systems/CollisionSystem.h"
+#include "systems/TriggerSystem.h"
+#include "systems/EntityCreationSystem.h"
+
+#include <gtest/gtest.h>
+
+class TriggerSystemTest : public ::testing::Test {
+protected:
+    EntityManager entityManager;
+    ComponentStorage<TransformComponent> transforms;
+    ComponentStorage<ColliderComponent> colliders;
+    EntityCreationSystem creationSystem{&entityManager};
+
+    TriggerSystem system{transforms, colliders};
+
+    void SetUp() override {
+        creationSystem.RegisterStorage(&transforms);
+        creationSystem.RegisterStorage(&colliders);
+        entityManager.RegisterComponentStorage(&transforms);
+        entityManager.RegisterComponentStorage(&colliders);
+    }
+
+    EntityID CreateBox(float x, float y, int size, CollisionLayer layer, CollisionLayer mask) {
+        return creationSystem.CreateEntityWith(
+            TransformComponent{ VectorFloat{x, y}, 0.0f, VectorFloat{1.0f, 1.0f} },
+            ColliderComponent{size, size, layer, mask}
+        );
+    }
+
+    void MoveTo(EntityID id, float x, float y) {
+        transforms.Get(id)->position = {x, y};
+    }
+};
+
+TEST_F(TriggerSystemTest, EmitsEnterAndExitOnce) {
+    EntityID zone = CreateBox(100.0f, 0.0f, 50, CollisionLayer::Trigger, CollisionLayer::Player);
+    EntityID player = CreateBox(0.0f, 0.0f, 10, CollisionLayer::Player, CollisionLayer::All);
+
+    system.Update(0.0f);
+    EXPECT_TRUE(system.GetEvents().empty());
+
+    MoveTo(player, 110.0f, 10.0f);
+    system.Update(0.0f);
+    ASSERT_EQ(system.GetEvents().size(), 1);
+    EXPECT_EQ(system.GetEvents()[0].trigger, zone);
+    EXPECT_EQ(system.GetEvents()[0].other, player);
+    EXPECT_EQ(system.GetEvents()[0].phase, TriggerPhase::Enter);
+    EXPECT_TRUE(system.IsInside(player, zone));
+
+    // Moving inside - no new events
+    MoveTo(player, 120.0f, 20.0f);
+    system.Update(0.0f);
+    EXPECT_TRUE(system.GetEvents().empty());
+
+    MoveTo(player, 300.0f, 0.0f);
+    system.Update(0.0f);
+    ASSERT_EQ(system.GetEvents().size(), 1);
+    EXPECT_EQ(system.GetEvents()[0].phase, TriggerPhase::Exit);
+    EXPECT_FALSE(system.IsInside(player, zone));
+}
+
+TEST_F(TriggerSystemTest, RespectsMasksAndDestroyedTriggers) {
+    EntityID pickup = creationSystem.CreateEntityWith(
+        TransformComponent{ VectorFloat{0.0f, 0.0f}, 0.0f, VectorFloat{1.0f, 1.0f} },
+        ColliderComponent{20, 20, CollisionLayer::Pickup, CollisionLayer::Player, false, true}
+    );
+    EntityID enemy = CreateBox(5.0f, 5.0f, 10, CollisionLayer::Enemy, CollisionLayer::Player);
+    EntityID player = CreateBox(5.0f, 5.0f, 10, CollisionLayer::Player, CollisionLayer::Enemy);
+
+    system.Update(0.0f);
+    ASSERT_EQ(system.GetEvents().size(), 1);
+    EXPECT_EQ(system.GetEvents()[0].other, player);
+    EXPECT_FALSE(system.IsInside(enemy, pickup));
+
+    // Picked up
+    entityManager.DestroyEntityFromList(pickup);
+    system.Update(0.0f);
+    ASSERT_EQ(system.GetEvents().size(), 1);
+    EXPECT_EQ(system.GetEvents()[0].phase, TriggerPhase::Exit);
+}
+
+TEST_F(TriggerSystemTest, CollisionSystemIgnoresTriggers) {
+    CollisionSystem collisionSystem{entityManager, transforms, colliders};
+    CreateBox(0.0f, 0.0f, 50, CollisionLayer::Sensor, CollisionLayer::All);
+    CreateBox(10.0f, 10.0f, 10, CollisionLayer::Player, CollisionLayer::All);
+
+    collisionSystem.Update(0.0f);
+    EXPECT_TRUE(collisionSystem.GetCollisions().empty());
+}
+
+TEST_F(TriggerSystemTest, SwapInOneFrameKeepsCountButRebuilds) {
+    EntityID zone = CreateBox(0.0f, 0.0f, 50, CollisionLayer::Trigger, CollisionLayer::Player);
+    EntityID first = CreateBox(10.0f, 10.0f, 10, CollisionLayer::Player, CollisionLayer::All);
+    system.Update(0.0f);
+    ASSERT_TRUE(system.IsInside(first, zone));
+
+    // One collider out, one in - same count
+    entityManager.DestroyEntityFromList(first);
+    EntityID second = CreateBox(20.0f, 20.0f, 10, CollisionLayer::Player, CollisionLayer::All);
+    system.Update(0.0f);
+
+    ASSERT_EQ(system.GetEvents().size(), 2);
+    EXPECT_EQ(system.GetEvents()[0].other, first);
+    EXPECT_EQ(system.GetEvents()[0].phase, TriggerPhase::Exit);
+    EXPECT_EQ(system.GetEvents()[1].other, second);
+    EXPECT_EQ(system.GetEvents()[1].phase, TriggerPhase::Enter);
+    EXPECT_FALSE(system.IsInside(first, zone));
+}
+
+TEST_F(TriggerSystemTest, MovedTriggerIsPickedUpAfterInvalidate) {
+    EntityID zone = CreateBox(0.0f, 0.0f, 50, CollisionLayer::Trigger, CollisionLayer::Player);
+    EntityID player = CreateBox(200.0f, 0.0f, 10, CollisionLayer::Player, CollisionLayer::All);
+    system.Update(0.0f);
+    EXPECT_TRUE(system.GetEvents().empty());
+
+    // The zone moves onto the resting player
+    MoveTo(zone, 180.0f, 0.0f);
+    system.InvalidateTriggers();
+    system.Update(0.0f);
+    ASSERT_EQ(system.GetEvents().size(), 1);
+    EXPECT_EQ(system.GetEvents()[0].phase, TriggerPhase::Enter);
+    EXPECT_TRUE(system.IsInside(player, zone));
+}